@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <set>
+
+#include "../s21_containers.h"
+
+// B-деревья против красно-черных деревьев (s21::set, s21::map) и std::set:
+// поиск, обход и вставка в случайном порядке, память на элемент
+
+// Считает байты, выделенные контейнером
+static std::size_t allocated_bytes = 0;
+
+template <typename T>
+struct counting_allocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = counting_allocator<U>;
+  };
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(const counting_allocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    allocated_bytes += n * sizeof(T);
+    return std::allocator<T>::allocate(n);
+  }
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    allocated_bytes -= n * sizeof(T);
+    std::allocator<T>::deallocate(ptr, n);
+  }
+};
+
+namespace s21 {
+template <typename T>
+struct allocator_is_plain<counting_allocator<T>> : std::true_type {};
+}  // namespace s21
+
+// Ключи 0, 2, 4, ... вставляются в перемешанном порядке
+template <typename Set>
+static void FillShuffled(Set& s, int n) {
+  for (int i = 0; i < n; ++i) s.insert(static_cast<int>(i * 7919LL % n) * 2);
+}
+
+template <typename Set>
+static void BM_Find(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  FillShuffled(s, n);
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.find(key));
+    key = (key + 7919 * 2) % (2 * n);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Set>
+static void BM_Iterate(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  FillShuffled(s, n);
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Set>
+static void BM_InsertShuffled(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Set s;
+    FillShuffled(s, n);
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Set>
+static void BM_EraseInsert(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  FillShuffled(s, n);
+  int key = 0;
+  for (auto _ : state) {
+    s.erase(s.find(key));
+    s.insert(key);
+    key = (key + 7919 * 2) % (2 * n);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Память дерева на один элемент
+template <typename Set>
+static void BM_BytesPerElement(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  double bytes = 0;
+  for (auto _ : state) {
+    const std::size_t before = allocated_bytes;
+    Set s;
+    FillShuffled(s, n);
+    bytes = static_cast<double>(allocated_bytes - before) / n;
+  }
+  state.counters["bytes_per_element"] = bytes;
+}
+
+// Поиск в словаре
+template <typename Map>
+static void BM_MapAt(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Map m;
+  for (int i = 0; i < n; ++i) {
+    m.insert({static_cast<int>(i * 7919LL % n), i});
+  }
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.at(key));
+    key = (key + 7919) % n;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T>
+using counting_btree_set = s21::btree_set<T, counting_allocator<T>>;
+template <typename T>
+using counting_set = s21::set<T, std::less<T>, counting_allocator<T>>;
+template <typename T>
+using counting_std_set = std::set<T, std::less<T>, counting_allocator<T>>;
+
+#define S21_BTREE_RANGE RangeMultiplier(16)->Range(1 << 10, 1 << 20)
+
+BENCHMARK_TEMPLATE(BM_Find, s21::btree_set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_Find, s21::set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_Find, std::set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_Iterate, s21::btree_set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_Iterate, s21::set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_Iterate, std::set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertShuffled, s21::btree_set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertShuffled, s21::set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertShuffled, std::set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_EraseInsert, s21::btree_set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_EraseInsert, s21::set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_EraseInsert, std::set<int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_BytesPerElement, counting_btree_set<int>)
+    ->Arg(1 << 20)
+    ->Iterations(1);
+BENCHMARK_TEMPLATE(BM_BytesPerElement, counting_set<int>)
+    ->Arg(1 << 20)
+    ->Iterations(1);
+BENCHMARK_TEMPLATE(BM_BytesPerElement, counting_std_set<int>)
+    ->Arg(1 << 20)
+    ->Iterations(1);
+BENCHMARK_TEMPLATE(BM_MapAt, s21::btree_map<int, int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_MapAt, s21::map<int, int>)->S21_BTREE_RANGE;
+BENCHMARK_TEMPLATE(BM_MapAt, std::map<int, int>)->S21_BTREE_RANGE;
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+#include "../s21_containers.h"
+
+// Словарь, общий для всех потоков: s21::concurrent_map против s21::map под
+// std::shared_mutex (читатели делят блокировку, писатели берут ее
+// целиком). В словаре 2^16 ключей из диапазона 2^17
+
+class locked_map {
+ public:
+  bool contains(int key) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+
+  bool insert_or_assign(int key, int value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    return map_.insert_or_assign(key, value).second;
+  }
+
+  std::size_t erase(int key) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (!map_.contains(key)) return 0;
+    map_.erase(map_.find(key));
+    return 1;
+  }
+
+ private:
+  mutable std::shared_mutex mutex_;
+  s21::map<int, int> map_;
+};
+
+constexpr int kKeyRange = 1 << 17;
+
+// Один словарь на все потоки и запуски, заполненный четными ключами
+template <typename Map>
+static Map& shared_map() {
+  static Map* map = [] {
+    Map* filled = new Map;
+    for (int key = 0; key < kKeyRange; key += 2) {
+      filled->insert_or_assign(key, key);
+    }
+    return filled;
+  }();
+  return *map;
+}
+
+// Случайные ключи, у каждого потока свой генератор
+static int next_key(std::uint32_t& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return static_cast<int>(state % kKeyRange);
+}
+
+// Из каждых 16 операций одна - запись (insert_or_assign), остальные -
+// поиск
+template <typename Map>
+static void BM_ReadMostly(benchmark::State& state) {
+  Map& map = shared_map<Map>();
+  std::uint32_t seed = 2463534242u + state.thread_index();
+  unsigned op = 0;
+  for (auto _ : state) {
+    const int key = next_key(seed) & ~1;
+    if (++op % 16 == 0) {
+      map.insert_or_assign(key, key);
+    } else {
+      benchmark::DoNotOptimize(map.contains(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Только запись: вставка и удаление нечетных ключей, размер словаря
+// остается около 2^16
+template <typename Map>
+static void BM_WriteHeavy(benchmark::State& state) {
+  Map& map = shared_map<Map>();
+  std::uint32_t seed = 2463534242u + state.thread_index();
+  unsigned op = 0;
+  for (auto _ : state) {
+    const int key = next_key(seed) | 1;
+    if (++op % 2 == 0) {
+      benchmark::DoNotOptimize(map.erase(key));
+    } else {
+      benchmark::DoNotOptimize(map.insert_or_assign(key, key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_ReadMostly, s21::concurrent_map<int, int>)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReadMostly, locked_map)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_WriteHeavy, s21::concurrent_map<int, int>)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_WriteHeavy, locked_map)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "../s21_containers.h"
+
+// Передача элементов между потоками: потоки с четным номером пишут,
+// с нечетным читают. Для сравнения - s21::queue под мьютексом
+
+class locked_queue {
+ public:
+  explicit locked_queue(std::size_t) {}
+
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(int& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int> queue_;
+};
+
+// Одна очередь на все потоки и все запуски: ее не нужно создавать до
+// старта потоков и удалять, пока кто-то из них еще работает
+template <typename Queue>
+static Queue& shared_queue() {
+  static Queue queue(1024);
+  return queue;
+}
+
+template <typename Queue>
+static void BM_Transfer(benchmark::State& state) {
+  Queue& queue = shared_queue<Queue>();
+  const bool producer = state.thread_index() % 2 == 0;
+  int value = 0;
+  for (auto _ : state) {
+    if (producer) {
+      while (!queue.try_push(value)) std::this_thread::yield();
+    } else {
+      while (!queue.try_pop(value)) std::this_thread::yield();
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Пакетами по 32 элемента
+template <typename Queue>
+static void BM_TransferBatch(benchmark::State& state) {
+  Queue& queue = shared_queue<Queue>();
+  const bool producer = state.thread_index() % 2 == 0;
+  int batch[32] = {};
+  for (auto _ : state) {
+    if (producer) {
+      for (int* next = batch; next != batch + 32;) {
+        std::size_t pushed = queue.try_push_many(next, batch + 32);
+        if (pushed == 0) std::this_thread::yield();
+        next += pushed;
+      }
+    } else {
+      for (std::size_t taken = 0; taken != 32;) {
+        std::size_t popped = queue.try_pop_many(batch, 32 - taken);
+        if (popped == 0) std::this_thread::yield();
+        taken += popped;
+      }
+      benchmark::DoNotOptimize(batch);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 32);
+}
+
+BENCHMARK_TEMPLATE(BM_Transfer, s21::spsc_queue<int>)
+    ->Threads(2)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_TransferBatch, s21::spsc_queue<int>)
+    ->Threads(2)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Transfer, s21::mpmc_queue<int>)
+    ->ThreadRange(2, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_TransferBatch, s21::mpmc_queue<int>)
+    ->ThreadRange(2, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Transfer, locked_queue)->ThreadRange(2, 8)->UseRealTime();
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "../s21_containers.h"
+
+// Упорядоченный вектор (flat_set) против деревьев: поиск в готовой таблице
+// и построение таблицы из неупорядоченных ключей - одним слиянием и
+// поштучной вставкой
+
+// Ключи 0, 2, 4, ... в перемешанном порядке
+static std::vector<int> ShuffledKeys(int n) {
+  std::vector<int> keys;
+  keys.reserve(n);
+  for (int i = 0; i < n; ++i) {
+    keys.push_back(static_cast<int>(i * 7919LL % n) * 2);
+  }
+  return keys;
+}
+
+template <typename Set>
+static void BM_Lookup(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  // Ключи идут по возрастанию, и вставка в flat_set дописывает их в конец
+  Set s;
+  for (int i = 0; i < n; ++i) s.insert(2 * i);
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.contains(key));
+    key = (key + 7919 * 2) % (2 * n);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Построение из диапазона: сортировка один раз
+template <typename Set>
+static void BM_BuildBulk(benchmark::State& state) {
+  const std::vector<int> keys = ShuffledKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    Set s(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Построение поштучной вставкой
+template <typename Set>
+static void BM_BuildOneByOne(benchmark::State& state) {
+  const std::vector<int> keys = ShuffledKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    Set s;
+    for (int key : keys) s.insert(key);
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Добавление пачки из 1/16 ключей к готовой таблице: слияние за O(n + m)
+// против m сдвигов хвоста
+static void BM_FlatAppendBatch(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<int> keys = ShuffledKeys(n);
+  std::vector<int> batch;
+  for (int i = 0; i < n / 16; ++i) batch.push_back(keys[i] + 1);
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::flat_set<int> s(keys.begin(), keys.end());
+    state.ResumeTiming();
+    if (state.range(1) == 0) {
+      s.insert(batch.begin(), batch.end());
+    } else {
+      for (int key : batch) s.insert(key);
+    }
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetItemsProcessed(state.iterations() * (n / 16));
+}
+
+#define S21_FLAT_RANGE RangeMultiplier(16)->Range(1 << 8, 1 << 20)
+
+BENCHMARK_TEMPLATE(BM_Lookup, s21::flat_set<int>)->S21_FLAT_RANGE;
+BENCHMARK_TEMPLATE(BM_Lookup, s21::btree_set<int>)->S21_FLAT_RANGE;
+BENCHMARK_TEMPLATE(BM_Lookup, s21::set<int>)->S21_FLAT_RANGE;
+BENCHMARK_TEMPLATE(BM_BuildBulk, s21::flat_set<int>)->S21_FLAT_RANGE;
+BENCHMARK_TEMPLATE(BM_BuildOneByOne, s21::flat_set<int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_BuildOneByOne, s21::set<int>)->S21_FLAT_RANGE;
+BENCHMARK(BM_FlatAppendBatch)
+    ->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}})
+    ->ArgNames({"n", "one_by_one"});
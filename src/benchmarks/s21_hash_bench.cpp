@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../s21_containers.h"
+
+// s21::unordered_map против std::unordered_map (узлы в цепочках) и
+// s21::map: поиск существующих и отсутствующих ключей, вставка с нуля,
+// удаление со вставкой, обход
+
+// Случайные, но воспроизводимые ключи
+static std::vector<std::uint64_t> RandomKeys(int n, std::uint64_t seed) {
+  std::vector<std::uint64_t> keys;
+  keys.reserve(n);
+  std::uint64_t state = seed;
+  for (int i = 0; i < n; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    keys.push_back(state);
+  }
+  return keys;
+}
+
+template <typename Map>
+static void BM_FindHit(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<std::uint64_t> keys = RandomKeys(n, 88172645463325252u);
+  Map m;
+  for (int i = 0; i < n; ++i) m.insert({keys[i], i});
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.find(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+static void BM_FindMiss(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<std::uint64_t> keys = RandomKeys(n, 88172645463325252u);
+  const std::vector<std::uint64_t> misses = RandomKeys(n, 2463534242u);
+  Map m;
+  for (int i = 0; i < n; ++i) m.insert({keys[i], i});
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.find(misses[i]));
+    if (++i == misses.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+static void BM_InsertFresh(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<std::uint64_t> keys = RandomKeys(n, 88172645463325252u);
+  for (auto _ : state) {
+    Map m;
+    for (int i = 0; i < n; ++i) m.insert({keys[i], i});
+    benchmark::DoNotOptimize(m.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Map>
+static void BM_EraseInsert(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<std::uint64_t> keys = RandomKeys(n, 88172645463325252u);
+  Map m;
+  for (int i = 0; i < n; ++i) m.insert({keys[i], i});
+  std::size_t i = 0;
+  for (auto _ : state) {
+    m.erase(m.find(keys[i]));
+    m.insert({keys[i], 0});
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+static void BM_Iterate(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<std::uint64_t> keys = RandomKeys(n, 88172645463325252u);
+  Map m;
+  for (int i = 0; i < n; ++i) m.insert({keys[i], i});
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = m.begin(); it != m.end(); ++it) sum += (*it).second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Строковые ключи: сравнение ключа дороже, и отсев по H2 экономит больше
+template <typename Map>
+static void BM_StringFind(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  std::vector<std::string> keys;
+  for (int i = 0; i < n; ++i) keys.push_back("key_" + std::to_string(i));
+  Map m;
+  for (int i = 0; i < n; ++i) m.insert({keys[i], i});
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.find(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+using s21_hash = s21::unordered_map<std::uint64_t, int>;
+using std_hash = std::unordered_map<std::uint64_t, int>;
+using s21_tree = s21::map<std::uint64_t, int>;
+
+#define S21_HASH_RANGE RangeMultiplier(16)->Range(1 << 8, 1 << 20)
+
+BENCHMARK_TEMPLATE(BM_FindHit, s21_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_FindHit, std_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_FindHit, s21_tree)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_FindMiss, s21_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_FindMiss, std_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertFresh, s21_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertFresh, std_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_EraseInsert, s21_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_EraseInsert, std_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_Iterate, s21_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_Iterate, std_hash)->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_StringFind, s21::unordered_map<std::string, int>)
+    ->S21_HASH_RANGE;
+BENCHMARK_TEMPLATE(BM_StringFind, std::unordered_map<std::string, int>)
+    ->S21_HASH_RANGE;
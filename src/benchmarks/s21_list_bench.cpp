@@ -0,0 +1,27 @@
+#include <benchmark/benchmark.h>
+
+#include <list>
+
+#include "../s21_containers.h"
+
+// Сортировка списка: перевязка узлов слиянием, O(n log n)
+
+template <typename List>
+static void BM_ListSort(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    List l;
+    for (int i = 0; i < n; ++i) l.push_back((i * 7919) % n);
+    state.ResumeTiming();
+    l.sort();
+    benchmark::DoNotOptimize(l.size());
+  }
+  state.SetComplexityN(n);
+}
+
+#define S21_SORT_RANGE \
+  RangeMultiplier(8)->Range(1 << 9, 1 << 18)->Complexity(benchmark::oNLogN)
+
+BENCHMARK_TEMPLATE(BM_ListSort, s21::list<int>)->S21_SORT_RANGE;
+BENCHMARK_TEMPLATE(BM_ListSort, std::list<int>)->S21_SORT_RANGE;
@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+
+#include "../s21_containers.h"
+
+// Поток через очередь: производитель и потребитель идут с небольшим
+// отставанием, как в конвейере. Узловая очередь выделяет память на каждый
+// push, кольцевая - только при росте
+
+template <typename Queue>
+static void BM_QueueStream(benchmark::State& state) {
+  const int lag = static_cast<int>(state.range(0));
+  Queue q;
+  for (int i = 0; i < lag; ++i) q.push(i);
+  long sum = 0;
+  for (auto _ : state) {
+    q.push(lag);
+    sum += q.front();
+    q.pop();
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, typename Storage>
+using storage_queue = s21::queue<T, std::allocator<T>, Storage>;
+
+BENCHMARK_TEMPLATE(BM_QueueStream, s21::queue<int>)->Range(16, 1 << 12);
+BENCHMARK_TEMPLATE(BM_QueueStream, storage_queue<int, s21::ring_storage<>>)
+    ->Range(16, 1 << 12);
+BENCHMARK_TEMPLATE(BM_QueueStream,
+                   storage_queue<int, s21::ring_storage<1 << 13>>)
+    ->Range(16, 1 << 12);
+BENCHMARK_TEMPLATE(BM_QueueStream, std::queue<int>)->Range(16, 1 << 12);
@@ -0,0 +1,485 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus/s21_containersplus.h"
+
+// Поиск в деревьях: время одного find/contains должно расти как O(log n)
+
+template <typename Set>
+static void FillSet(Set& s, int n) {
+  for (int i = 0; i < n; ++i) s.insert(i);
+}
+
+template <typename Set>
+static void BM_Find(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  FillSet(s, n);
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.find(key));
+    key = (key + 7919) % n;
+  }
+  state.SetComplexityN(n);
+}
+
+template <typename Set>
+static void BM_LowerBound(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  FillSet(s, n);
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.lower_bound(key));
+    key = (key + 7919) % n;
+  }
+  state.SetComplexityN(n);
+}
+
+static void BM_MapContains(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::map<int, int> m;
+  for (int i = 0; i < n; ++i) m.insert({i, i});
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.contains(key));
+    key = (key + 7919) % n;
+  }
+  state.SetComplexityN(n);
+}
+
+#define S21_LOOKUP_RANGE \
+  RangeMultiplier(4)->Range(1 << 8, 1 << 20)->Complexity(benchmark::oLogN)
+
+BENCHMARK_TEMPLATE(BM_Find, s21::set<int>)->S21_LOOKUP_RANGE;
+BENCHMARK_TEMPLATE(BM_Find, s21::multiset<int>)->S21_LOOKUP_RANGE;
+BENCHMARK_TEMPLATE(BM_Find, std::set<int>)->S21_LOOKUP_RANGE;
+BENCHMARK_TEMPLATE(BM_LowerBound, s21::set<int>)->S21_LOOKUP_RANGE;
+BENCHMARK_TEMPLATE(BM_LowerBound, std::set<int>)->S21_LOOKUP_RANGE;
+BENCHMARK(BM_MapContains)->S21_LOOKUP_RANGE;
+
+// Вставка отсортированного потока: обычная и с подсказкой
+
+template <typename Set>
+static void BM_InsertSorted(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Set s;
+    for (int i = 0; i < n; ++i) s.insert(i);
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetComplexityN(n);
+}
+
+template <typename Set>
+static void BM_InsertSortedHint(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Set s;
+    auto hint = s.begin();
+    for (int i = 0; i < n; ++i) hint = s.insert(hint, i);
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetComplexityN(n);
+}
+
+#define S21_INSERT_RANGE \
+  RangeMultiplier(8)->Range(1 << 10, 1 << 19)->Complexity()
+
+BENCHMARK_TEMPLATE(BM_InsertSorted, s21::set<int>)->S21_INSERT_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertSortedHint, s21::set<int>)->S21_INSERT_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertSortedHint, s21::multiset<int>)->S21_INSERT_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertSorted, std::set<int>)->S21_INSERT_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertSortedHint, std::set<int>)->S21_INSERT_RANGE;
+
+// Выделение узлов: построение и очистка дерева, удаление со вставкой.
+// pool_allocator берет узлы из больших блоков и освобождает их разом
+
+template <typename Set>
+static void BM_BuildClear(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) s.insert((i * 7919) % n);
+    s.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Set>
+static void BM_EraseInsert(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  FillSet(s, n);
+  int key = 0;
+  for (auto _ : state) {
+    s.erase(s.find(key));
+    s.insert(key);
+    key = (key + 7919) % n;
+  }
+}
+
+using pool_int_set = s21::set<int, std::less<int>, s21::pool_allocator<int>>;
+
+BENCHMARK_TEMPLATE(BM_BuildClear, s21::set<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_BuildClear, pool_int_set)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_BuildClear, std::set<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_EraseInsert, s21::set<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_EraseInsert, pool_int_set)->Range(1 << 10, 1 << 18);
+
+// Построение из диапазона: упорядоченный вход подвешивается деревом за
+// O(n), неупорядоченный сначала сортируется. Для сравнения - поштучная
+// вставка тех же ключей
+
+static std::vector<int> BuildKeys(int n, bool sorted) {
+  std::vector<int> keys;
+  keys.reserve(n);
+  for (int i = 0; i < n; ++i) {
+    keys.push_back(sorted ? i : static_cast<int>(i * 7919LL % n));
+  }
+  return keys;
+}
+
+template <typename Set>
+static void BM_BuildRange(benchmark::State& state) {
+  const std::vector<int> keys =
+      BuildKeys(static_cast<int>(state.range(0)), state.range(1) != 0);
+  for (auto _ : state) {
+    Set s(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Set>
+static void BM_BuildOneByOne(benchmark::State& state) {
+  const std::vector<int> keys =
+      BuildKeys(static_cast<int>(state.range(0)), state.range(1) != 0);
+  for (auto _ : state) {
+    Set s;
+    for (int key : keys) s.insert(key);
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Копирование повторяет форму дерева; pool_allocator готовит все узлы
+// копии одним куском
+using pool_int_map =
+    s21::map<int, int, std::less<int>,
+             s21::pool_allocator<std::pair<const int, int>>>;
+
+template <typename Map>
+static void BM_MapCopy(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Map m;
+  for (int i = 0; i < n; ++i) m.insert({(i * 7919) % n, i});
+  for (auto _ : state) {
+    Map copy(m);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Слияние двух множеств по n ключей, половина ключей общая
+template <typename Set>
+static void BM_Merge(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  std::vector<int> evens, odds;
+  for (int i = 0; i < n; ++i) {
+    evens.push_back(2 * i);
+    odds.push_back(i + n);
+  }
+  for (auto _ : state) {
+    state.PauseTiming();
+    Set a(evens.begin(), evens.end());
+    Set b(odds.begin(), odds.end());
+    state.ResumeTiming();
+    a.merge(b);
+    benchmark::DoNotOptimize(a.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define S21_BUILD_RANGE \
+  ArgsProduct({{1 << 10, 1 << 14, 1 << 18}, {0, 1}})->ArgNames({"n", "sorted"})
+
+BENCHMARK_TEMPLATE(BM_BuildRange, s21::set<int>)->S21_BUILD_RANGE;
+BENCHMARK_TEMPLATE(BM_BuildRange, s21::multiset<int>)->S21_BUILD_RANGE;
+BENCHMARK_TEMPLATE(BM_BuildRange, std::set<int>)->S21_BUILD_RANGE;
+BENCHMARK_TEMPLATE(BM_BuildOneByOne, s21::set<int>)->S21_BUILD_RANGE;
+BENCHMARK_TEMPLATE(BM_MapCopy, s21::map<int, int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_MapCopy, pool_int_map)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_MapCopy, std::map<int, int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_Merge, s21::set<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_Merge, std::set<int>)->Range(1 << 10, 1 << 18);
+
+// Пересечение и объединение множеств идентификаторов: n ключей слева и
+// n / ratio справа. Для сравнения - поиск каждого ключа меньшего множества
+// в большем и std::set_intersection над std::set
+
+static void FillIds(int n, int ratio, std::vector<int>& lhs,
+                    std::vector<int>& rhs) {
+  for (int i = 0; i < n; ++i) lhs.push_back(2 * i);
+  for (int i = 0; i < n / ratio; ++i) rhs.push_back(3 * ratio * i);
+}
+
+static void BM_Intersection(benchmark::State& state) {
+  std::vector<int> lhs, rhs;
+  FillIds(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)),
+          lhs, rhs);
+  s21::set<int> a(lhs.begin(), lhs.end());
+  s21::set<int> b(rhs.begin(), rhs.end());
+  for (auto _ : state) {
+    s21::set<int> result = a.set_intersection(b);
+    benchmark::DoNotOptimize(result.size());
+  }
+}
+
+static void BM_IntersectionLookup(benchmark::State& state) {
+  std::vector<int> lhs, rhs;
+  FillIds(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)),
+          lhs, rhs);
+  s21::set<int> a(lhs.begin(), lhs.end());
+  for (auto _ : state) {
+    s21::set<int> result;
+    for (int key : rhs) {
+      if (a.contains(key)) result.insert(key);
+    }
+    benchmark::DoNotOptimize(result.size());
+  }
+}
+
+static void BM_IntersectionStd(benchmark::State& state) {
+  std::vector<int> lhs, rhs;
+  FillIds(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)),
+          lhs, rhs);
+  std::set<int> a(lhs.begin(), lhs.end());
+  std::set<int> b(rhs.begin(), rhs.end());
+  for (auto _ : state) {
+    std::set<int> result;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                          std::inserter(result, result.end()));
+    benchmark::DoNotOptimize(result.size());
+  }
+}
+
+static void BM_Union(benchmark::State& state) {
+  std::vector<int> lhs, rhs;
+  FillIds(static_cast<int>(state.range(0)), 1, lhs, rhs);
+  s21::set<int> a(lhs.begin(), lhs.end());
+  s21::set<int> b(rhs.begin(), rhs.end());
+  for (auto _ : state) {
+    s21::set<int> result = a.set_union(b);
+    benchmark::DoNotOptimize(result.size());
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+
+#define S21_ALGEBRA_RANGE \
+  ArgsProduct({{1 << 14, 1 << 18}, {1, 64}})->ArgNames({"n", "ratio"})
+
+BENCHMARK(BM_Intersection)->S21_ALGEBRA_RANGE;
+BENCHMARK(BM_IntersectionLookup)->S21_ALGEBRA_RANGE;
+BENCHMARK(BM_IntersectionStd)->S21_ALGEBRA_RANGE;
+BENCHMARK(BM_Union)->Range(1 << 10, 1 << 18);
+
+// Обход с проверкой it != end() на каждом шаге и поиск отсутствующего
+// ключа, который возвращает end(). Обе операции не должны зависеть от
+// высоты дерева сверх самого обхода и спуска
+
+template <typename Set>
+static void BM_IterateToEnd(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  FillSet(s, n);
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Set>
+static void BM_FindMissing(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Set s;
+  FillSet(s, n);
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.find(n + key) == s.end());
+    key = (key + 7919) % n;
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_IterateToEnd, s21::set<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_IterateToEnd, std::set<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_FindMissing, s21::set<int>)->S21_LOOKUP_RANGE;
+BENCHMARK_TEMPLATE(BM_FindMissing, std::set<int>)->S21_LOOKUP_RANGE;
+
+// Поиск по std::string_view в дереве строк. С std::less<std::string> на
+// каждый поиск строится временная строка (ключи длиннее SSO, то есть с
+// выделением памяти), с прозрачным std::less<> сравнение идет напрямую
+
+template <typename Set>
+static void BM_FindStringView(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  std::vector<std::string> keys;
+  Set s;
+  for (int i = 0; i < n; ++i) {
+    keys.push_back("benchmark-key-" + std::to_string(1000000 + i));
+    s.insert(keys.back());
+  }
+  int index = 0;
+  for (auto _ : state) {
+    const std::string_view key = keys[index];
+    if constexpr (std::is_same_v<typename Set::key_compare, std::less<>>) {
+      benchmark::DoNotOptimize(s.find(key));
+    } else {
+      benchmark::DoNotOptimize(s.find(std::string(key)));
+    }
+    index = (index + 7919) % n;
+  }
+  state.SetComplexityN(n);
+}
+
+using string_set = s21::set<std::string>;
+using transparent_string_set =
+    s21::set<std::string, std::less<>>;
+BENCHMARK_TEMPLATE(BM_FindStringView, string_set)->S21_LOOKUP_RANGE;
+BENCHMARK_TEMPLATE(BM_FindStringView, transparent_string_set)
+    ->S21_LOOKUP_RANGE;
+
+// Порядковая статистика на multiset с повторами: медиана и число ключей в
+// диапазоне. Обычное дерево отвечает обходом за O(n), дерево с размерами
+// поддеревьев - спуском за O(log n)
+
+template <typename Multiset>
+static void FillSkewed(Multiset& s, int n) {
+  for (int i = 0; i < n; ++i) s.insert((i * 7919) % (n / 4 + 1));
+}
+
+static void BM_MedianLinear(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::multiset<int> s;
+  FillSkewed(s, n);
+  for (auto _ : state) {
+    auto it = s.begin();
+    for (size_t k = 0; k < s.size() / 2; ++k) ++it;
+    benchmark::DoNotOptimize(*it);
+  }
+  state.SetComplexityN(n);
+}
+
+static void BM_MedianRanked(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::ranked::multiset<int> s;
+  FillSkewed(s, n);
+  for (auto _ : state) benchmark::DoNotOptimize(*s.nth(s.size() / 2));
+  state.SetComplexityN(n);
+}
+
+static void BM_CountRangeLinear(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::multiset<int> s;
+  FillSkewed(s, n);
+  int lo = 0;
+  for (auto _ : state) {
+    size_t count = 0;
+    auto last = s.lower_bound(lo + n / 16);
+    for (auto it = s.lower_bound(lo); it != last; ++it) ++count;
+    benchmark::DoNotOptimize(count);
+    lo = (lo + 7919) % (n / 8 + 1);
+  }
+  state.SetComplexityN(n);
+}
+
+static void BM_CountRangeRanked(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::ranked::multiset<int> s;
+  FillSkewed(s, n);
+  int lo = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.count_range(lo, lo + n / 16));
+    lo = (lo + 7919) % (n / 8 + 1);
+  }
+  state.SetComplexityN(n);
+}
+
+// Цена поддержки размеров при вставке
+template <typename Multiset>
+static void BM_InsertSkewed(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Multiset s;
+    FillSkewed(s, n);
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetComplexityN(n);
+}
+
+#define S21_LINEAR_RANGE \
+  Range(1 << 10, 1 << 18)->Complexity(benchmark::oN)
+
+BENCHMARK(BM_MedianLinear)->S21_LINEAR_RANGE;
+BENCHMARK(BM_MedianRanked)->S21_LOOKUP_RANGE;
+BENCHMARK(BM_CountRangeLinear)->S21_LINEAR_RANGE;
+BENCHMARK(BM_CountRangeRanked)->S21_LOOKUP_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertSkewed, s21::multiset<int>)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_InsertSkewed, s21::ranked::multiset<int>)
+    ->Range(1 << 10, 1 << 18);
+
+// Мультимножество с большим числом повторов: n элементов над 4096
+// различными ключами. counted_multiset хранит по узлу на ключ, поэтому
+// вставка повтора не выделяет памяти, а count - один спуск
+
+constexpr int kDistinctKeys = 4096;
+
+template <typename Multiset>
+static void BM_InsertDuplicates(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Multiset s;
+    for (int i = 0; i < n; ++i) s.insert((i * 7919) % kDistinctKeys);
+    benchmark::DoNotOptimize(s.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Multiset>
+static void BM_CountDuplicates(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Multiset s;
+  for (int i = 0; i < n; ++i) s.insert((i * 7919) % kDistinctKeys);
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.count(key));
+    key = (key + 7919) % kDistinctKeys;
+  }
+}
+
+#define S21_DUPLICATES_RANGE RangeMultiplier(8)->Range(1 << 12, 1 << 21)
+
+BENCHMARK_TEMPLATE(BM_InsertDuplicates, s21::multiset<int>)
+    ->S21_DUPLICATES_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertDuplicates, s21::counted_multiset<int>)
+    ->S21_DUPLICATES_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertDuplicates, std::multiset<int>)
+    ->S21_DUPLICATES_RANGE;
+BENCHMARK_TEMPLATE(BM_CountDuplicates, s21::multiset<int>)
+    ->S21_DUPLICATES_RANGE;
+BENCHMARK_TEMPLATE(BM_CountDuplicates, s21::ranked::multiset<int>)
+    ->S21_DUPLICATES_RANGE;
+BENCHMARK_TEMPLATE(BM_CountDuplicates, s21::counted_multiset<int>)
+    ->S21_DUPLICATES_RANGE;
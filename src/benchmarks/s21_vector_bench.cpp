@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "../s21_containers.h"
+
+// Перенос элементов вектора: побайтный (memcpy/memmove) против поэлементного.
+// Аллокатор ниже не помечен как allocator_is_plain, поэтому с ним вектор
+// переносит те же элементы по одному, через construct/destroy
+
+template <typename T>
+struct elementwise_allocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = elementwise_allocator<U>;
+  };
+  elementwise_allocator() = default;
+  template <typename U>
+  elementwise_allocator(const elementwise_allocator<U>&) noexcept {}
+};
+
+// Запись фиксированного размера, тривиально копируемая
+struct Record {
+  long fields[8];
+};
+
+// Владеющий тип: поэлементный перенос - это перемещение, обнуление
+// источника и вызов его деструктора; побайтный - просто memcpy
+struct Owned {
+  std::unique_ptr<long> value;
+};
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<Owned> : std::true_type {};
+}  // namespace s21
+
+template <typename Vector>
+static void BM_PushBack(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Vector v;
+    for (int i = 0; i < n; ++i) v.push_back(typename Vector::value_type{});
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Vector>
+static void BM_Reserve(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Vector v(n);
+    state.ResumeTiming();
+    v.reserve(2 * n);  // Один перенос n элементов
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Vector>
+static void BM_InsertEraseFront(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  Vector v(n);
+  for (auto _ : state) {
+    v.insert(v.begin(), typename Vector::value_type{});
+    v.erase(v.begin());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+using elementwise_vector = s21::vector<T, elementwise_allocator<T>>;
+
+#define S21_VECTOR_RANGE RangeMultiplier(8)->Range(1 << 8, 1 << 17)
+
+BENCHMARK_TEMPLATE(BM_PushBack, s21::vector<Record>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_PushBack, elementwise_vector<Record>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_PushBack, std::vector<Record>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_Reserve, s21::vector<Record>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_Reserve, elementwise_vector<Record>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_Reserve, std::vector<Record>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_Reserve, s21::vector<Owned>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_Reserve, elementwise_vector<Owned>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertEraseFront, s21::vector<int>)->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertEraseFront, elementwise_vector<int>)
+    ->S21_VECTOR_RANGE;
+BENCHMARK_TEMPLATE(BM_InsertEraseFront, std::vector<int>)->S21_VECTOR_RANGE;
@@ -0,0 +1,199 @@
+#ifndef S21_ALLOCATOR_H_
+#define S21_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>  // For std::shared_ptr
+#include <memory_resource>
+#include <type_traits>
+#include <utility>  // For std::pair
+
+namespace s21 {
+
+// Пул блоков фиксированного размера. Блоки нарезаются из больших кусков
+// памяти (slabs), освобожденные блоки переиспользуются через список свободных.
+// Для каждого размера блока ведется свой список; release() возвращает
+// системе все куски разом
+class pool_resource {
+ public:
+  explicit pool_resource(std::size_t blocks_per_slab = 256) noexcept;
+  pool_resource(const pool_resource&) = delete;
+  pool_resource& operator=(const pool_resource&) = delete;
+  ~pool_resource();
+
+  void* allocate(std::size_t bytes);
+  void deallocate(void* ptr, std::size_t bytes) noexcept;
+  // Готовит место под count блоков размера bytes без новых выделений
+  // памяти. Если свободных блоков нет, следующие count блоков идут в одном
+  // куске подряд
+  void reserve(std::size_t bytes, std::size_t count);
+  // Освобождает все куски; выделенные ранее блоки становятся недействительными
+  void release() noexcept;
+
+ private:
+  struct Slab {
+    Slab* next;
+  };
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+  struct Pool {
+    std::size_t block_size;
+    FreeBlock* free_list;
+    char* cursor;  // Еще не выданная часть последнего куска
+    char* end;
+  };
+
+  static constexpr std::size_t kMaxPools = 8;
+  static constexpr std::size_t kAlign = alignof(std::max_align_t);
+
+  static std::size_t block_size_for(std::size_t bytes) noexcept;
+  Pool* find_pool(std::size_t block_size) noexcept;
+  void refill(Pool& pool, std::size_t blocks);
+
+  std::size_t blocks_per_slab_;
+  Pool pools_[kMaxPools];
+  std::size_t pool_count_;
+  Slab* slabs_;
+};
+
+// Аллокатор поверх pool_resource. Одиночные объекты (узлы деревьев и
+// списков) берутся из пула, массивы - из operator new.
+// Копии и rebind разделяют один пул. Контейнер, который единолично владеет
+// пулом (unique()), может освобождать память целыми кусками через release()
+template <typename T, std::size_t BlocksPerSlab = 256>
+class pool_allocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U>
+  struct rebind {
+    using other = pool_allocator<U, BlocksPerSlab>;
+  };
+
+  pool_allocator();
+  pool_allocator(const pool_allocator& other) noexcept = default;
+  template <typename U>
+  pool_allocator(const pool_allocator<U, BlocksPerSlab>& other) noexcept;
+  pool_allocator& operator=(const pool_allocator& other) noexcept = default;
+
+  T* allocate(std::size_t n);
+  void deallocate(T* ptr, std::size_t n) noexcept;
+
+  // Копия контейнера получает собственный пул
+  pool_allocator select_on_container_copy_construction() const;
+
+  bool unique() const noexcept;
+  void release() noexcept;
+  // Готовит в пуле место под n одиночных объектов подряд
+  void reserve(std::size_t n);
+
+  template <typename U>
+  bool operator==(const pool_allocator<U, BlocksPerSlab>& other) const noexcept;
+  template <typename U>
+  bool operator!=(const pool_allocator<U, BlocksPerSlab>& other) const noexcept;
+
+ private:
+  template <typename, std::size_t>
+  friend class pool_allocator;
+
+  // Одиночный объект обычного выравнивания можно взять из пула
+  static constexpr bool kPooled = alignof(T) <= alignof(std::max_align_t);
+
+  std::shared_ptr<pool_resource> resource_;
+};
+
+// Правила распространения аллокатора между контейнерами при присваивании и
+// обмене (std::allocator_traits::propagate_on_container_*)
+template <typename Alloc>
+void alloc_on_copy(Alloc& to, const Alloc& from);
+template <typename Alloc>
+void alloc_on_move(Alloc& to, Alloc& from);
+template <typename Alloc>
+void alloc_on_swap(Alloc& lhs, Alloc& rhs);
+// Сменится ли аллокатор при копирующем присваивании. Тогда старые элементы
+// нужно освободить до смены аллокатора
+template <typename Alloc>
+bool alloc_changes_on_copy(const Alloc& to, const Alloc& from);
+// Может ли перемещающее присваивание забрать память источника целиком.
+// Иначе элементы переносятся поштучно в память своего аллокатора
+template <typename Alloc>
+bool alloc_can_steal(const Alloc& to, const Alloc& from);
+// Забирает ли перемещающее присваивание память источника при любых
+// аллокаторах. Только тогда оно не выделяет памяти и объявлено noexcept
+template <typename Alloc, typename Traits = std::allocator_traits<Alloc>>
+struct allocator_always_steals
+    : std::disjunction<typename Traits::propagate_on_container_move_assignment,
+                       typename Traits::is_always_equal> {};
+
+// Признак аллокатора, умеющего освобождать всю память разом
+template <typename Alloc, typename = void>
+struct allocator_has_release : std::false_type {};
+
+template <typename Alloc>
+struct allocator_has_release<
+    Alloc, std::void_t<decltype(std::declval<const Alloc&>().unique()),
+                       decltype(std::declval<Alloc&>().release())>>
+    : std::true_type {};
+
+// Признак аллокатора, умеющего заранее подготовить память под много
+// одиночных объектов
+template <typename Alloc, typename = void>
+struct allocator_has_reserve : std::false_type {};
+
+template <typename Alloc>
+struct allocator_has_reserve<
+    Alloc, std::void_t<decltype(std::declval<Alloc&>().reserve(
+               std::declval<std::size_t>()))>> : std::true_type {};
+
+// Готовит память под n одиночных объектов, если аллокатор это умеет
+template <typename Alloc>
+void alloc_reserve(Alloc& alloc, std::size_t n);
+
+// Объект можно перенести побайтно: копия байтов на новое место вместе с
+// отказом от деструктора старого объекта равносильна перемещению. По
+// умолчанию это тривиально копируемые типы; специализация разрешает
+// побайтный перенос и для других (например, владеющих одним указателем)
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Элемент словаря: пара с неизменяемым ключом. Контейнеры, которые хранят
+// элементы в ячейках (btree, hash_table), при переносе между ячейками
+// перемещают и ключ: старая ячейка сразу разрушается и ключ в ней больше
+// никто не увидит
+template <typename V>
+struct const_key_pair : std::false_type {
+  static constexpr bool nothrow_relocate =
+      std::is_nothrow_move_constructible_v<V>;
+};
+
+template <typename K, typename T>
+struct const_key_pair<std::pair<const K, T>> : std::true_type {
+  using mutable_key = K;
+  static constexpr bool nothrow_relocate =
+      std::is_nothrow_move_constructible_v<K> &&
+      std::is_nothrow_move_constructible_v<T>;
+};
+
+// Аллокатор создает и разрушает объекты обычными placement new и ~T(),
+// поэтому контейнер может переносить элементы в обход его construct/destroy
+template <typename Alloc>
+struct allocator_is_plain : std::false_type {};
+
+template <typename T>
+struct allocator_is_plain<std::allocator<T>> : std::true_type {};
+
+template <typename T>
+struct allocator_is_plain<std::pmr::polymorphic_allocator<T>>
+    : std::true_type {};
+
+template <typename T, std::size_t BlocksPerSlab>
+struct allocator_is_plain<pool_allocator<T, BlocksPerSlab>> : std::true_type {};
+
+}  // namespace s21
+
+#include "s21_allocator.inc"
+#endif  // S21_ALLOCATOR_H_
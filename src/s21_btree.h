@@ -0,0 +1,253 @@
+#ifndef S21_BTREE_H_
+#define S21_BTREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>  // For std::memmove
+#include <initializer_list>
+#include <iterator>
+#include <memory>  // For std::allocator_traits
+#include <tuple>   // For std::forward_as_tuple
+#include <type_traits>
+#include <utility>  // For std::forward
+
+#include "s21_allocator.h"
+#include "s21_storage.h"  // For cache_line_size
+#include "s21_tree.h"     // For tree_key_identity, tree_key_first
+#include "s21_vector.h"
+
+namespace s21 {
+
+template <typename Key, typename Value, typename KeyOf, bool Multi,
+          typename Allocator>
+struct btree_params {
+  using key_type = Key;
+  using value_type = Value;
+  using key_of = KeyOf;
+  using allocator_type = Allocator;
+  static constexpr bool multi = Multi;
+};
+
+// Общая основа btree_set, btree_map и btree_multiset. В отличие от
+// красно-черных деревьев, где на каждый элемент приходится узел с тремя
+// указателями, узел B-дерева хранит подряд до kSlots элементов и занимает
+// несколько строк кэша (около kNodeBytes байт). Дерево ниже в log2(kSlots)
+// раз, поиск проходит меньше узлов, а обход идет по соседним элементам
+// массива. Все листья лежат на одной глубине.
+// Платой за плотность служит перенос элементов внутри узла: вставка и
+// удаление сдвигают соседние элементы, поэтому итераторы и ссылки на
+// элементы становятся недействительными после любой вставки или удаления.
+// Перемещающий конструктор элемента не должен бросать исключений.
+// Параметры собраны в btree_params: Value - тип элемента, KeyOf извлекает
+// из него ключ (как в s21_tree.h), Multi разрешает эквивалентные ключи
+template <typename Params>
+class btree {
+  using Key = typename Params::key_type;
+  using Value = typename Params::value_type;
+  using KeyOf = typename Params::key_of;
+  using Allocator = typename Params::allocator_type;
+  static constexpr bool Multi = Params::multi;
+
+  static_assert(const_key_pair<Value>::nothrow_relocate,
+                "btree elements must be nothrow move constructible");
+
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using allocator_type = Allocator;
+
+ private:
+  static constexpr std::size_t kNodeBytes = 256;
+  static constexpr std::size_t kHeaderBytes = 16;
+  static constexpr std::size_t kFitSlots =
+      (kNodeBytes - kHeaderBytes) / sizeof(Value);
+
+ public:
+  // Число элементов в узле: не меньше 3, чтобы при делении в каждой
+  // половине оставался элемент, и не больше 254 (позиция - один байт)
+  static constexpr int kSlots =
+      kFitSlots < 3 ? 3 : (kFitSlots > 254 ? 254 : static_cast<int>(kFitSlots));
+
+ private:
+  // Узел, который после удаления содержит меньше kMinSlots элементов,
+  // занимает элемент у соседа или сливается с ним
+  static constexpr int kMinSlots = kSlots / 2;
+
+  struct Internal;
+
+  // Лист. Элементы [0, count) создаются и разрушаются по одному
+  struct alignas(cache_line_size) Node {
+    Internal* parent;
+    std::uint8_t position;  // Номер в массиве детей родителя
+    std::uint8_t count;
+    bool leaf;
+    alignas(Value) unsigned char storage[kSlots * sizeof(Value)];
+
+    Value* values() noexcept { return reinterpret_cast<Value*>(storage); }
+    Value& value(int i) noexcept { return values()[i]; }
+  };
+
+  // Внутренний узел: count элементов и count + 1 детей. Ключи поддерева
+  // children[i] лежат между элементами i - 1 и i
+  struct Internal : Node {
+    Node* children[kSlots + 1];
+  };
+
+  using leaf_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using internal_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Internal>;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  // Элементы переносятся внутри узла и между узлами. Если это допустимо,
+  // перенос побайтный; иначе - перемещение с разрушением источника
+  static constexpr bool kBitwise = is_trivially_relocatable<Value>::value &&
+                                   allocator_is_plain<Allocator>::value;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    iterator();
+
+    reference operator*() const;
+    pointer operator->() const;
+    iterator& operator++();
+    iterator operator++(int);
+    iterator& operator--();
+    iterator operator--(int);
+    bool operator==(const iterator& other) const;
+    bool operator!=(const iterator& other) const;
+
+   private:
+    friend class btree;
+    iterator(Node* node, int position);
+
+    Node* node_;
+    int position_;  // end() - позиция count в самом правом листе
+  };
+
+  // Вставка уникального ключа возвращает пару (позиция, вставлен ли
+  // элемент), вставка в мультимножество - только позицию
+  using insert_return_type =
+      std::conditional_t<Multi, iterator, std::pair<iterator, bool>>;
+
+  btree();
+  explicit btree(const Allocator& alloc);
+  btree(std::initializer_list<value_type> const& items);
+  btree(const btree& other);
+  btree(const btree& other, const Allocator& alloc);
+  btree(btree&& other) noexcept;
+  ~btree();
+
+  btree& operator=(const btree& other);
+  btree& operator=(btree&& other) noexcept(
+      allocator_always_steals<Allocator>::value);
+
+  allocator_type get_allocator() const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const noexcept;
+  size_type size() const;
+  size_type max_size() const noexcept;
+
+  void clear();
+  insert_return_type insert(const value_type& value);
+  insert_return_type insert(value_type&& value);
+  // Вставка с подсказкой: hint - позиция, перед которой ожидается элемент.
+  // При верной подсказке поиск места не нужен
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  // Элемент создается из args во временном объекте и переносится в узел
+  template <typename... Args>
+  insert_return_type emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
+  void erase(iterator pos);
+  void swap(btree& other);
+  void merge(btree& other);
+
+  bool contains(const Key& key) const;
+  iterator find(const Key& key) const;
+  size_type count(const Key& key) const;
+  iterator lower_bound(const Key& key) const;
+  iterator upper_bound(const Key& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+ protected:
+  // Место для ключа: существующий элемент с таким ключом (found) либо
+  // позиция в листе, куда ключ вставляется
+  struct insert_pos {
+    iterator pos;
+    bool found;
+  };
+
+  template <typename K>
+  insert_pos unique_pos(const K& key) const;
+  template <typename K>
+  insert_pos equal_pos(const K& key) const;
+  // Верна ли подсказка: элемент с ключом key встает прямо перед hint
+  template <typename K>
+  bool hint_fits(iterator hint, const K& key) const;
+  // Создает элемент из args перед pos и возвращает его позицию. args
+  // могут ссылаться на элементы этого же дерева
+  template <typename... Args>
+  iterator insert_at(iterator pos, Args&&... args);
+
+ private:
+  static Node* child(Node* node, int i) noexcept;
+  static void set_child(Node* node, int i, Node* child) noexcept;
+  // Первый элемент узла, ключ которого не меньше (больше) key
+  template <typename K>
+  static int lower_index(Node* node, const K& key);
+  template <typename K>
+  static int upper_index(Node* node, const K& key);
+  // Переносит n элементов из src в dst; области могут перекрываться
+  static void move_values(Allocator& alloc, Value* dst, Value* src, int n);
+  static void relocate(Allocator& alloc, Value* dst, Value* src);
+
+  template <typename V>
+  insert_return_type insert_value(V&& value);
+  template <typename V>
+  iterator insert_value(iterator hint, V&& value);
+
+  Node* create_leaf();
+  Internal* create_internal();
+  void deallocate_node(Node* node) noexcept;
+  // Разрушает элементы поддерева и освобождает его узлы
+  void destroy_subtree(Node* node) noexcept;
+  // Делит полный узел node пополам, поднимая средний элемент в родителя.
+  // node и position указывают на место вставки, после деления оно может
+  // оказаться в новом правом узле
+  void split(Node*& node, int& position);
+  // Восстанавливает заполненность узлов после удаления из node
+  void rebalance(Node* node);
+  void merge_nodes(Node* left, Node* right);
+  void borrow_from_left(Node* node);
+  void borrow_from_right(Node* node);
+  // Обмен деревьями без учета аллокаторов
+  void swap_nodes(btree& other) noexcept;
+
+  Allocator alloc_;
+  Node* root_;
+  Node* rightmost_;  // Самый правый лист, в нем находится end()
+  size_type size_;
+};
+
+}  // namespace s21
+
+#include "s21_btree.inc"
+#endif  // S21_BTREE_H_
@@ -0,0 +1,62 @@
+#ifndef S21_BTREE_MAP_H_
+#define S21_BTREE_MAP_H_
+
+#include <memory>  // For std::allocator
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>    // For std::forward_as_tuple
+#include <utility>  // For std::piecewise_construct
+
+#include "s21_btree.h"
+
+namespace s21 {
+
+// Словарь на B-дереве с тем же интерфейсом, что у s21::map. Пары лежат в
+// узлах по нескольку подряд; при переносе внутри дерева ключ перемещается.
+// Вставка и удаление делают итераторы и ссылки на значения
+// недействительными
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class btree_map : public btree<btree_params<Key, std::pair<const Key, T>,
+                                            tree_key_first, false, Allocator>> {
+  using base = btree<
+      btree_params<Key, std::pair<const Key, T>, tree_key_first, false,
+                   Allocator>>;
+
+ public:
+  using mapped_type = T;
+  using typename base::iterator;
+  using typename base::value_type;
+
+  using base::base;
+
+  T& at(const Key& key);
+  T& operator[](const Key& key);
+  T& operator[](Key&& key);
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, T&& obj);
+  std::pair<iterator, bool> insert_or_assign(Key&& key, T&& obj);
+  // Пара создается, только если ключа еще нет
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+
+ private:
+  template <typename K, typename M>
+  std::pair<iterator, bool> assign_key(K&& key, M&& obj);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(K&& key, Args&&... args);
+};
+
+namespace pmr {
+template <typename Key, typename T>
+using btree_map = s21::btree_map<
+    Key, T, std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#include "s21_btree_map.inc"
+#endif  // S21_BTREE_MAP_H_
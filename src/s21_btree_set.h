@@ -0,0 +1,26 @@
+#ifndef S21_BTREE_SET_H_
+#define S21_BTREE_SET_H_
+
+#include <memory>  // For std::allocator
+#include <memory_resource>
+
+#include "s21_btree.h"
+
+namespace s21 {
+
+// Множество на B-дереве с тем же интерфейсом, что у s21::set. Элементы
+// лежат в узлах по несколько десятков подряд: на элемент уходит меньше
+// памяти, а поиск и обход касаются меньшего числа строк кэша. Вставка и
+// удаление делают итераторы недействительными
+template <typename T, typename Allocator = std::allocator<T>>
+using btree_set =
+    btree<btree_params<T, T, tree_key_identity, false, Allocator>>;
+
+namespace pmr {
+template <typename Key>
+using btree_set = s21::btree_set<Key, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // S21_BTREE_SET_H_
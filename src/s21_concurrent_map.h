@@ -0,0 +1,180 @@
+#ifndef S21_CONCURRENT_MAP_H_
+#define S21_CONCURRENT_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>  // For std::allocator_traits
+#include <mutex>   // For std::lock_guard
+#include <new>
+#include <stdexcept>
+#include <thread>  // For std::this_thread::yield
+#include <utility>  // For std::pair
+
+#include "s21_storage.h"  // For cache_line_size
+
+namespace s21 {
+
+// Упорядоченный словарь для работы из многих потоков: ленивый skip list
+// (Herlihy, Lev, Luchangco, Shavit). Каждый узел лежит в списке уровня 0 и
+// в нескольких списках уровней выше, поэтому поиск идет за O(log n) в
+// среднем, как у дерева, но без перебалансировки.
+// Поиск (contains, at, for_each) не берет блокировок на пути по списку.
+// insert и erase блокируют только соседей изменяемого узла, так что
+// операции с разными ключами почти не мешают друг другу.
+// Удаленный узел сначала помечается (логическое удаление), затем
+// исключается из списков. Другие потоки могут еще стоять на нем, поэтому
+// память возвращается по эпохам (epoch-based reclamation, Fraser): каждая
+// операция на время работы объявляет глобальную эпоху, а узел, удаленный
+// в эпохе e, освобождается, когда эпоха дойдет до e + 2. Эпоха растет,
+// только если все работающие операции уже объявили текущую, поэтому к
+// этому моменту завершились все операции, которые могли видеть узел.
+// Удаленные узлы копятся в трех списках по остатку эпохи от деления на 3;
+// поток, сдвинувший эпоху, освобождает список, ставший безопасным. Сдвиг
+// пробует erase после каждых kAdvanceEvery удалений. Если неосвобожденных
+// узлов больше kMaxPending, erase уступает процессор: эпоху держит
+// прерванная операция, и ей нужно дать завершиться. Так при постоянных
+// вставках и удалениях память не растет
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  concurrent_map();
+  explicit concurrent_map(const Allocator& alloc);
+  concurrent_map(const concurrent_map&) = delete;
+  concurrent_map& operator=(const concurrent_map&) = delete;
+  ~concurrent_map();
+
+  // Возвращают false, если ключ уже есть; значение тогда не меняется
+  bool insert(const value_type& value);
+  bool insert(const Key& key, const T& obj);
+  // Вставляет ключ или заменяет значение. true - если ключ был вставлен
+  bool insert_or_assign(const Key& key, const T& obj);
+  // Удаляет ключ, возвращает число удаленных элементов (0 или 1)
+  size_type erase(const Key& key);
+
+  // Возвращает копию значения: ссылка на значение могла бы пережить его
+  // замену в другом потоке
+  T at(const Key& key) const;
+  bool contains(const Key& key) const;
+
+  // Обходит элементы по возрастанию ключа и вызывает f с копией каждой
+  // пары. Обход не блокирует других: элемент, вставленный или удаленный во
+  // время обхода, может как попасть в него, так и нет. Пока идет обход,
+  // удаленные узлы не освобождаются
+  template <typename F>
+  void for_each(F f) const;
+
+  // Число элементов; пока другие потоки работают, оно приблизительно
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  allocator_type get_allocator() const;
+
+  // Освобождает память удаленных узлов, которых уже не видит ни одна
+  // операция. Можно вызывать в любой момент; если другие потоки не
+  // работают с контейнером, освобождаются все удаленные узлы
+  void reclaim() noexcept;
+
+ private:
+  static constexpr int kMaxLevel = 16;
+  // Ячейки для эпох одновременно идущих операций. Если все заняты,
+  // следующая операция ждет освобождения ячейки
+  static constexpr int kEpochSlots = 64;
+  // Число удалений между попытками сдвинуть эпоху
+  static constexpr std::size_t kAdvanceEvery = 8;
+  static constexpr std::size_t kMaxPending = 256;
+  // Списки удаленных узлов: эпохи e, e - 1 и e - 2 по модулю 3
+  static constexpr int kLimbo = 3;
+  // Значение свободной ячейки эпохи; глобальная эпоха начинается с 1
+  static constexpr std::uint64_t kIdle = 0;
+
+  // Блокировка узла. Держится недолго, поэтому ожидание - активное, с
+  // уступкой процессора другим потокам
+  class spin_lock {
+   public:
+    void lock() noexcept;
+    void unlock() noexcept;
+
+   private:
+    std::atomic<bool> locked_{false};
+  };
+
+  // За узлом в той же памяти лежит массив из height указателей next
+  struct Node {
+    std::atomic<bool> marked;        // Удален логически
+    std::atomic<bool> fully_linked;  // Включен во все свои уровни
+    spin_lock lock;
+    int height;
+    Node* retired_next;  // Список удаленных узлов, ждущих освобождения
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    explicit Node(int h) noexcept;
+    value_type& value() noexcept;
+    const Key& key() noexcept;
+    std::atomic<Node*>* next() noexcept;
+  };
+
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  // Заблокированные предшественники; снимает блокировки при выходе
+  class pred_locks;
+  // Эпоха, объявленная операцией. Каждая ячейка - в своей строке кэша
+  struct alignas(cache_line_size) epoch_slot {
+    std::atomic<std::uint64_t> epoch{kIdle};
+  };
+  // Объявляет эпоху на время операции и снимает ее при выходе
+  class epoch_guard;
+
+  static int random_level() noexcept;
+  // Число единиц размера Node под узел высоты height вместе с его next
+  static size_type node_units(int height) noexcept;
+
+  template <typename... Args>
+  Node* create_node(int height, Args&&... args);
+  Node* create_head();
+  void destroy_node(Node* node) noexcept;
+  void release_head() noexcept;
+
+  // Заполняет preds и succs на каждом уровне (preds[l]->key < key <=
+  // succs[l]->key). Возвращает верхний уровень, на котором найден узел с
+  // ключом, или -1
+  int find(const Key& key, Node** preds, Node** succs) const;
+  // Вставка ключа, если его нет. Если ключ есть и Assign, значение
+  // заменяется
+  template <bool Assign>
+  bool insert_node(const Key& key, const T& obj);
+  // Узел с ключом, видимый как существующий, или nullptr
+  Node* find_live(const Key& key) const;
+  // Помечает и исключает из списков узел с ключом; nullptr, если ключа нет
+  Node* unlink(const Key& key);
+  // Откладывает освобождение исключенного узла до безопасной эпохи
+  void retire(Node* node) noexcept;
+  // Сдвигает эпоху, если все работающие операции объявили текущую, и
+  // освобождает узлы, удаленные две эпохи назад
+  void try_advance() noexcept;
+  // Освобождает узлы списка и возвращает их число
+  size_type free_list(Node* node) noexcept;
+
+  node_allocator node_alloc_;
+  Node* head_;
+  alignas(cache_line_size) std::atomic<size_type> size_;
+  std::atomic<size_type> pending_;  // Удаленные, но не освобожденные
+  std::atomic<Node*> retired_[kLimbo];
+  alignas(cache_line_size) std::atomic<std::uint64_t> epoch_;
+  mutable epoch_slot slots_[kEpochSlots];
+};
+
+}  // namespace s21
+
+#include "s21_concurrent_map.inc"
+
+#endif  // S21_CONCURRENT_MAP_H_
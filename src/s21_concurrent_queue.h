@@ -0,0 +1,158 @@
+#ifndef S21_CONCURRENT_QUEUE_H_
+#define S21_CONCURRENT_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>  // For std::distance
+#include <memory>  // For std::allocator_traits
+#include <type_traits>
+#include <utility>  // For std::forward
+
+#include "s21_storage.h"  // For cache_line_size
+
+namespace s21 {
+
+// Наименьшая степень двойки, не меньшая n (и не меньшая 2)
+inline std::size_t ring_capacity_for(std::size_t n) noexcept;
+
+// Индексы, которые меняют разные потоки, разнесены по разным строкам кэша
+// (alignas(cache_line_size)), чтобы запись одного потока не сбрасывала кэш
+// другого. alignas выравнивает и размер класса, так что за последним
+// индексом других полей в той же строке нет.
+
+// Ограниченные очереди для обмена между потоками. Емкость задается в
+// конструкторе и округляется вверх до степени двойки. Операции не
+// блокируют: try_push в полную очередь и try_pop из пустой возвращают
+// false. Очереди нельзя копировать и перемещать.
+
+// Очередь для одного производителя и одного потребителя: try_push вызывает
+// только один поток, try_pop - только один (возможно, другой). Каждая
+// операция завершается за конечное число шагов (wait-free)
+template <typename T, typename Allocator = std::allocator<T>>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  explicit spsc_queue(size_type capacity, const Allocator& alloc = Allocator());
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+  ~spsc_queue();
+
+  // Сторона производителя
+  bool try_push(const T& value);
+  bool try_push(T&& value);
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  // Добавляет префикс [first, last), сколько поместится, и публикует его
+  // одной записью индекса. Возвращает число добавленных элементов
+  template <typename ForwardIt>
+  size_type try_push_many(ForwardIt first, ForwardIt last);
+
+  // Сторона потребителя
+  bool try_pop(T& out);
+  // Перемещает в out до max элементов, возвращает их число
+  template <typename OutputIt>
+  size_type try_pop_many(OutputIt out, size_type max);
+
+  // Размер на момент вызова; пока другие потоки работают, он приблизителен
+  size_type size_approx() const noexcept;
+  size_type capacity() const noexcept;
+  allocator_type get_allocator() const;
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  Allocator alloc_;
+  T* slots_;
+  size_type mask_;
+
+  // Индекс головы пишет потребитель, хвоста - производитель. Рядом с
+  // каждым лежит копия чужого индекса, которую поток обновляет, только
+  // когда очередь по ней выглядит полной (пустой)
+  alignas(cache_line_size) std::atomic<size_type> head_;
+  size_type tail_cache_;
+  alignas(cache_line_size) std::atomic<size_type> tail_;
+  size_type head_cache_;
+};
+
+// Ограниченная очередь для любого числа производителей и потребителей.
+// У каждой ячейки есть номер: по нему поток видит, свободна ли ячейка для
+// его позиции, и захватывает позицию одним compare_exchange. Ожидания
+// блокировки нет, но поток может повторять попытку, пока другие успевают
+// раньше (lock-free).
+// Элемент создается в ячейке уже после захвата позиции, поэтому T должен
+// перемещаться и присваиваться без исключений
+template <typename T, typename Allocator = std::allocator<T>>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T> &&
+                    std::is_nothrow_destructible_v<T>,
+                "mpmc_queue requires nothrow move and destruction");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  explicit mpmc_queue(size_type capacity, const Allocator& alloc = Allocator());
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+  ~mpmc_queue();
+
+  bool try_push(const T& value);
+  bool try_push(T&& value);
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  // Захватывает сразу несколько подряд идущих свободных ячеек.
+  // Возвращает число добавленных элементов
+  template <typename ForwardIt>
+  size_type try_push_many(ForwardIt first, ForwardIt last);
+
+  bool try_pop(T& out);
+  // Захватывает до max подряд идущих элементов и перемещает их в out.
+  // Если запись в out бросит исключение, оставшиеся захваченные элементы
+  // теряются, но очередь остается согласованной
+  template <typename OutputIt>
+  size_type try_pop_many(OutputIt out, size_type max);
+
+  size_type size_approx() const noexcept;
+  size_type capacity() const noexcept;
+  allocator_type get_allocator() const;
+
+ private:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+    T* value() noexcept { return reinterpret_cast<T*>(storage); }
+  };
+
+  using cell_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+  using cell_traits = std::allocator_traits<cell_allocator>;
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  // Захватывает до want подряд идущих позиций для записи (Readable =
+  // false) или чтения; первая позиция возвращается в pos. Возвращает число
+  // захваченных позиций, 0 - если очередь полна (пуста)
+  template <bool Readable>
+  size_type claim(std::atomic<size_type>& position, size_type want,
+                  size_type& pos);
+  // Освобождает ячейку прочитанной позиции для записи на следующем круге
+  void release_cell(size_type pos) noexcept;
+
+  Allocator alloc_;
+  Cell* cells_;
+  size_type mask_;
+
+  alignas(cache_line_size) std::atomic<size_type> enqueue_pos_;
+  alignas(cache_line_size) std::atomic<size_type> dequeue_pos_;
+};
+
+}  // namespace s21
+
+#include "s21_concurrent_queue.inc"
+
+#endif  // S21_CONCURRENT_QUEUE_H_
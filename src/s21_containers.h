@@ -1,11 +1,21 @@
 #ifndef S21_CONTAINERS_H_
 #define S21_CONTAINERS_H_
 
+#include "s21_allocator.h"
+#include "s21_btree_map.h"
+#include "s21_btree_set.h"
+#include "s21_concurrent_map.h"
+#include "s21_concurrent_queue.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
 #include "s21_list.h"
 #include "s21_map.h"
 #include "s21_queue.h"
 #include "s21_set.h"
 #include "s21_stack.h"
+#include "s21_storage.h"
+#include "s21_unordered_map.h"
+#include "s21_unordered_set.h"
 #include "s21_vector.h"
 
 #endif  // S21_CONTAINERS_H_
@@ -0,0 +1,25 @@
+#ifndef S21_BTREE_MULTISET_H_
+#define S21_BTREE_MULTISET_H_
+
+#include <memory>  // For std::allocator
+#include <memory_resource>
+
+#include "../s21_btree.h"
+
+namespace s21 {
+
+// Мультимножество на B-дереве с тем же интерфейсом, что у s21::multiset.
+// Эквивалентные элементы лежат подряд в порядке вставки
+template <typename T, typename Allocator = std::allocator<T>>
+using btree_multiset =
+    btree<btree_params<T, T, tree_key_identity, true, Allocator>>;
+
+namespace pmr {
+template <typename Key>
+using btree_multiset =
+    s21::btree_multiset<Key, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // S21_BTREE_MULTISET_H_
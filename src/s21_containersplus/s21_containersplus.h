@@ -2,6 +2,9 @@
 #define S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_btree_multiset.h"
+#include "s21_counted_multiset.h"
+#include "s21_flat_multiset.h"
 #include "s21_multiset.h"
 
 #endif  // S21_CONTAINERSPLUS_H_
\ No newline at end of file
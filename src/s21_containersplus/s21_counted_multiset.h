@@ -0,0 +1,155 @@
+#ifndef S21_COUNTED_MULTISET_H_
+#define S21_COUNTED_MULTISET_H_
+
+#include <functional>  // For std::less
+#include <iterator>    // For std::bidirectional_iterator_tag
+#include <limits>
+#include <memory>  // For std::allocator_traits
+#include <memory_resource>
+#include <utility>  // For std::pair, std::exchange
+
+#include "../s21_map.h"
+#include "../s21_vector.h"
+
+namespace s21 {
+
+// Мультимножество со сжатием повторов: узел дерева хранит ключ и число его
+// копий, поэтому память и вставка зависят от числа различных ключей d, а не
+// от числа элементов n. Вставка повтора не выделяет памяти, count - один
+// спуск за O(log d). Копии не различаются: из эквивалентных по Compare
+// элементов хранится первый вставленный.
+// Интерфейс - как у s21::multiset; итератор проходит каждую копию и дает
+// только константный доступ
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+class counted_multiset {
+ public:
+  using size_type = std::size_t;
+  using Key = T;
+  using value_type = Key;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using value_compare = Compare;
+
+ private:
+  // Серии: ключ и число его копий
+  using run_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<std::pair<const Key, size_type>>;
+  using runs_type = map<Key, size_type, Compare, run_allocator>;
+  using run_iterator = typename runs_type::const_iterator;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    iterator();
+
+    const Key& operator*() const;
+    iterator& operator++();
+    iterator operator++(int);
+    iterator& operator--();
+    iterator operator--(int);
+    bool operator==(const iterator& other) const;
+    bool operator!=(const iterator& other) const;
+
+   private:
+    iterator(run_iterator run, size_type copy);
+
+    run_iterator run_;  // Серия текущего элемента; end() серий - конец
+    size_type copy_;    // Номер копии внутри серии
+    friend class counted_multiset;
+  };
+
+  // Элементы в любом случае только для чтения
+  using const_iterator = iterator;
+
+  // Constructors
+  counted_multiset();
+  explicit counted_multiset(const Allocator& alloc);
+  explicit counted_multiset(const Compare& comp,
+                            const Allocator& alloc = Allocator());
+  counted_multiset(std::initializer_list<value_type> const& items);
+  // Повтор предыдущего элемента диапазона добавляется в его серию за O(1)
+  template <typename InputIt>
+  counted_multiset(InputIt first, InputIt last,
+                   const Compare& comp = Compare());
+  counted_multiset(const counted_multiset& other);
+  counted_multiset(counted_multiset&& other) noexcept;
+
+  // Assignment operators
+  counted_multiset& operator=(const counted_multiset& other);
+  counted_multiset& operator=(counted_multiset&& other) noexcept(
+      allocator_always_steals<Allocator>::value);
+
+  allocator_type get_allocator() const;
+  key_compare key_comp() const;
+  value_compare value_comp() const;
+
+  // Iterators
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  // Capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  // Число различных ключей, то есть узлов дерева
+  size_type distinct_size() const noexcept;
+
+  // Modifiers
+  void clear();
+  // Итератор указывает на последнюю копию value, как у multiset
+  iterator insert(const value_type& value);
+  iterator insert(value_type&& value);
+  // Добавляет count копий value за один спуск и возвращает итератор на
+  // первую из них (end(), если count == 0)
+  iterator insert(const value_type& value, size_type count);
+  template <typename... Args>
+  iterator emplace(Args&&... args);
+  // Удаляет одну копию. Итераторы на последнюю копию серии, а если копия
+  // была единственной - на весь ключ, становятся недействительными
+  void erase(iterator pos);
+  // Удаляет все копии key и возвращает их число
+  size_type erase(const Key& key);
+  void swap(counted_multiset& other);
+  // Серии с новыми ключами переходят из other без копирования (как в
+  // map::merge), счетчики остальных складываются. other становится пустым
+  void merge(counted_multiset& other);
+
+  // Lookup
+  bool contains(const Key& key) const;
+  size_type count(const Key& key) const;
+  const_iterator find(const Key& key) const;
+  const_iterator lower_bound(const Key& key) const;
+  const_iterator upper_bound(const Key& key) const;
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key& key) const;
+
+  // Part3
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+ private:
+  runs_type runs_;
+  size_type size_;  // Сумма счетчиков всех серий
+};
+
+namespace pmr {
+template <typename Key, typename Compare = std::less<Key>>
+using counted_multiset =
+    s21::counted_multiset<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#include "s21_counted_multiset.inc"
+#endif  // S21_COUNTED_MULTISET_H_
@@ -0,0 +1,26 @@
+#ifndef S21_FLAT_MULTISET_H_
+#define S21_FLAT_MULTISET_H_
+
+#include <memory>  // For std::allocator
+#include <memory_resource>
+
+#include "../s21_flat_tree.h"
+
+namespace s21 {
+
+// Мультимножество в упорядоченном векторе с тем же интерфейсом поиска,
+// что у s21::multiset. Эквивалентные элементы лежат подряд в порядке
+// вставки, count - разность двух двоичных поисков
+template <typename T, typename Allocator = std::allocator<T>>
+using flat_multiset =
+    flat_tree<flat_params<T, T, tree_key_identity, true, Allocator>>;
+
+namespace pmr {
+template <typename Key>
+using flat_multiset =
+    s21::flat_multiset<Key, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // S21_FLAT_MULTISET_H_
@@ -1,76 +1,142 @@
 #ifndef S21_MULTISET_H_
 #define S21_MULTISET_H_
 
-#include <memory>  // For std::allocator_traits
+#include <functional>  // For std::less
+#include <iterator>    // For std::bidirectional_iterator_tag
+#include <memory>      // For std::allocator_traits
+#include <memory_resource>
+#include <utility>  // For std::forward
 
+#include "../s21_allocator.h"
 #include "../s21_stack.h"
+#include "../s21_tree.h"
 #include "../s21_vector.h"
 
 namespace s21 {
-template <typename T>
-class multiset {
+// Compare задает порядок элементов, как и у set. Allocator выделяет узлы
+// дерева; s21::pool_allocator нарезает их из больших блоков и позволяет
+// освобождать память целиком. Ranked включает порядковую статистику,
+// тоже как у set, и с ней count за O(log n) вместо O(log n + count)
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>, bool Ranked = false>
+class multiset : private tree_compare<Compare> {
+  using compare_base = tree_compare<Compare>;
+
  public:
   using size_type = std::size_t;  // Определение size_type как std::size_t
   using Key = T;
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const reference;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using value_compare = Compare;
 
  private:
-  enum Color { RED, BLACK, END };
+  enum Color { RED, BLACK };
 
-  struct Node {
+  struct Node : tree_rank<Ranked> {
     Key value;
     Node* left;
     Node* right;
     Node* parent;
     Color color;
 
-    // Конструктор для инициализации узла
-    Node(const Key& val, Color c, Node* p)
-        : value(val), left(nullptr), right(nullptr), parent(p), color(c) {}
+    // Значение создается прямо в узле из аргументов insert/emplace
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : value(std::forward<Args>(args)...),
+          left(nullptr),
+          right(nullptr),
+          parent(nullptr),
+          color(RED) {}
   };
 
+  using lookup = tree_lookup<Node, tree_key_identity, Compare>;
+  using insert_pos = tree_insert_pos<Node>;
+  using builder = tree_builder<Node, tree_key_identity, Compare>;
+  using chain = tree_chain<Node>;
+  using order = tree_order<Node, tree_key_identity, Compare>;
+  using compare_base::comp;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
   Node* root_;
+  // Крайние узлы дерева: begin() за O(1) и вставка в конец за O(1).
+  // Позиция end() - nullptr, поэтому end() ничего не вычисляет и не
+  // пишет в узлы, и константное дерево можно читать из нескольких потоков
+  Node* leftmost_;
+  Node* rightmost_;
   size_type size_;
 
   // Внутренний класс итератора
  public:
-  class iterator {
+  // Итератор только для чтения. iterator наследуется от него, поэтому
+  // iterator приводится к const_iterator, а обратного приведения нет
+  class const_iterator {
    public:
-    using iterator_category = std::forward_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
     using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    // Конструктор
+    const_iterator();
+
+    // Операторы разыменования
+    const Key& operator*() const;
+    // Оператор инкремента
+    const_iterator& operator++();
+    const_iterator operator++(int);
+    // Оператор декремента
+    const_iterator& operator--();
+    const_iterator operator--(int);
+    // Оператор сравнения
+    bool operator==(const const_iterator& other) const;
+    bool operator!=(const const_iterator& other) const;
+
+   protected:
+    const_iterator(Node* node, const multiset* tree);
+
+    Node* current_;  // Текущий узел; nullptr - позиция end()
+    // Дерево итератора: с end() шаг назад ведет к его максимуму
+    const multiset* tree_;
+    friend class multiset;
+  };
+
+  class iterator : public const_iterator {
+   public:
     using pointer = T*;
+    using reference = T&;
 
-    // Конструкторы
     iterator();
-    iterator(Node* node);
-    iterator(const iterator& other);
 
-    // Операторы разыменования
     Key& operator*();
-    // Оператор инкремента
     iterator& operator++();
     iterator operator++(int);
-    // Оператор декремента
     iterator& operator--();
     iterator operator--(int);
-    // Оператор сравнения
-    bool operator==(const iterator& other) const;
-    bool operator!=(const iterator& other) const;
-    iterator& operator=(const iterator& other);
 
    private:
-    Node* current_;  // Указатель на текущий узел
+    iterator(Node* node, const multiset* tree);
     friend class multiset;
-    Node* find_min(Node* node);
-    Node* find_max(Node* node);
   };
 
   // Constructors
   multiset();
+  explicit multiset(const Allocator& alloc);
+  explicit multiset(const Compare& comp, const Allocator& alloc = Allocator());
   multiset(std::initializer_list<value_type> const& items);
+  // Элементы в любом порядке. Упорядоченный диапазон превращается в дерево
+  // за O(n), остальной сортируется один раз; равные элементы сохраняют
+  // порядок диапазона
+  template <typename InputIt>
+  multiset(InputIt first, InputIt last, const Compare& comp = Compare());
   multiset(const multiset& ms);
+  multiset(const multiset& ms, const Allocator& alloc);
   multiset(multiset&& ms) noexcept;
 
   // Destructor
@@ -80,11 +146,23 @@ class multiset {
   // копирование
   multiset& operator=(const multiset& ms);
   // перемещение
-  multiset& operator=(multiset&& ms) noexcept;
+  multiset& operator=(multiset&& ms) noexcept(
+      allocator_always_steals<Allocator>::value);
+
+  allocator_type get_allocator() const;
+  key_compare key_comp() const;
+  value_compare value_comp() const;
 
   // Iterators
-  iterator begin() const;
-  iterator end() const;
+  // Константные методы ничего не пишут в дерево и не выделяют память,
+  // поэтому константный контейнер можно читать из нескольких потоков
+  // без блокировок
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
 
   // Capacity
   bool empty() const noexcept;
@@ -94,17 +172,85 @@ class multiset {
   // Modifiers
   void clear();
   iterator insert(const value_type& value);
-  void erase(iterator pos);
+  iterator insert(value_type&& value);
+  // Вставка с подсказкой: hint - позиция, перед которой ожидается элемент
+  iterator insert(const_iterator hint, const value_type& value);
+  iterator insert(const_iterator hint, value_type&& value);
+  // Элемент создается прямо в узле из args; вставка всегда успешна
+  template <typename... Args>
+  iterator emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
+  void erase(const_iterator pos);
+  // Удаляет все элементы, эквивалентные key, и возвращает их число.
+  // Итераторы обоих видов уходят в erase(const_iterator)
+  size_type erase(const Key& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<K, const_iterator>>>
+  size_type erase(const K& key);
   void swap(multiset& other);
+  // Узлы other переходят в дерево без копирования, если память выделена
+  // равными аллокаторами; иначе элементы копируются. O(n + m)
   void merge(multiset& other);
+  // Операции над множествами по двум упорядоченным последовательностям за
+  // O(n + m), см. tree_builder::combine. Результат - новое сбалансированное
+  // дерево с аллокатором, выбранным как при копировании *this
+  multiset set_union(const multiset& other) const;
+  multiset set_intersection(const multiset& other) const;
+  multiset set_difference(const multiset& other) const;
+  multiset set_symmetric_difference(const multiset& other) const;
 
   // Lookup
+  // Перегрузки с шаблонным K, как и у set, доступны только для прозрачного
+  // компаратора и ищут ключ без временного Key
   bool contains(const Key& key) const;
-  iterator find(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  bool contains(const K& key) const;
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  iterator find(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  const_iterator find(const K& key) const;
+  // По умолчанию O(log n + count): спуск к первому равному и обход всех
+  // равных. За O(log n) считают ranked::multiset (разность рангов) и
+  // counted_multiset (счетчик в узле серии)
   size_type count(const Key& key) const;
-  iterator lower_bound(const Key& key) const;
-  iterator upper_bound(const Key& key) const;
-  std::pair<iterator, iterator> equal_range(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  size_type count(const K& key) const;
+  iterator lower_bound(const Key& key);
+  const_iterator lower_bound(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  iterator lower_bound(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  const_iterator lower_bound(const K& key) const;
+  iterator upper_bound(const Key& key);
+  const_iterator upper_bound(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  iterator upper_bound(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  const_iterator upper_bound(const K& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key);
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  std::pair<iterator, iterator> equal_range(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const;
+
+  // Order statistic, только при Ranked = true; все операции за O(log n)
+  // Элемент с номером k в порядке обхода (с нуля); end(), если k >= size()
+  iterator nth(size_type k);
+  const_iterator nth(size_type k) const;
+  // Число элементов с ключом меньше key, то есть номер lower_bound(key)
+  size_type rank(const Key& key) const;
+  // Число элементов с ключом из [lo, hi)
+  size_type count_range(const Key& lo, const Key& hi) const;
+  // Номер позиции pos в порядке обхода; index(end()) == size()
+  size_type index(const_iterator pos) const;
+  // Число шагов от first до last, как std::distance
+  std::ptrdiff_t distance(const_iterator first, const_iterator last) const;
 
   // Part3
   template <typename... Args>
@@ -112,6 +258,29 @@ class multiset {
 
  private:
   // Приватные функции для балансировки и работы с деревом
+  // Привязывает новый узел в найденную позицию и балансирует дерево
+  Node* link_node(const insert_pos& pos, Node* node);
+  // Общая часть count и erase по ключу любого сравнимого типа
+  template <typename K>
+  size_type count_equal(const K& key) const;
+  template <typename K>
+  size_type erase_equal(const K& key);
+  // Выделение и освобождение узлов через аллокатор
+  template <typename... Args>
+  Node* create_node(Args&&... args);
+  void destroy_node(Node* node);
+  // Строит дерево пустого контейнера из [first, last) через tree_builder
+  template <typename InputIt>
+  void build(InputIt first, InputIt last);
+  // Подвешивает список узлов как сбалансированное дерево вместо текущего
+  void adopt(const chain& nodes);
+  multiset combine(const multiset& other, tree_set_op op) const;
+  // Можно ли забирать узлы other: их память выделена равным аллокатором
+  bool shares_memory(const multiset& other) const;
+  // Освобождает все узлы дерева, не трогая root_ и size_
+  void release_nodes();
+  // Обмен деревьями без учета аллокаторов
+  void swap_nodes(multiset& other) noexcept;
   void balance_after_insert(Node* node);
   void balance_after_erase(Node* node, Node* parent);
   void rotate_left(Node* node);
@@ -120,6 +289,18 @@ class multiset {
   Node* find_max(Node* node) const;
 };
 
+namespace pmr {
+template <typename Key, typename Compare = std::less<Key>>
+using multiset =
+    s21::multiset<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+
+namespace ranked {
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
+using multiset = s21::multiset<Key, Compare, Allocator, true>;
+}  // namespace ranked
+
 }  // namespace s21
 
 #include "s21_multiset.inc"
@@ -1,6 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <climits>
+#include <iterator>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "../s21_containersplus.h"
 
@@ -16,6 +25,196 @@ TEST(multiset_Iterator, End) {
   ASSERT_EQ(*s21_iterator, *std_iterator);
 }
 
+TEST(multiset_Iterator, Reverse_From_End) {
+  s21::multiset<int> s21_mset = {5, 7, 3, 4, 2, 6, 8, 5, 5, 2};
+  std::multiset<int> std_mset = {5, 7, 3, 4, 2, 6, 8, 5, 5, 2};
+  auto s21_it = s21_mset.end();
+  for (auto std_it = std_mset.rbegin(); std_it != std_mset.rend(); ++std_it) {
+    --s21_it;
+    ASSERT_EQ(*s21_it, *std_it);
+  }
+  ASSERT_EQ(s21_it, s21_mset.begin());
+}
+
+TEST(multiset_Iterator, Std_Algorithms) {
+  using multiset = s21::multiset<int>;
+  static_assert(std::is_same_v<
+                std::iterator_traits<multiset::const_iterator>::value_type,
+                int>);
+  static_assert(std::is_same_v<
+                std::iterator_traits<multiset::iterator>::iterator_category,
+                std::bidirectional_iterator_tag>);
+  const multiset s21_mset = {2, 1, 2, 3};
+  ASSERT_EQ(*std::prev(s21_mset.cend()), 3);
+  ASSERT_EQ(std::distance(s21_mset.begin(), s21_mset.end()), 4);
+  ASSERT_EQ(std::count(s21_mset.cbegin(), s21_mset.cend(), 2), 2);
+}
+
+TEST(multiset_Lookup, Count_Const) {
+  const s21::multiset<int> empty;
+  ASSERT_EQ(empty.count(1), 0U);
+  const s21::multiset<int> s21_mset = {3, 1, 3, 2, 3, 1};
+  ASSERT_EQ(s21_mset.count(3), 3U);
+  ASSERT_EQ(s21_mset.count(1), 2U);
+  ASSERT_EQ(s21_mset.count(4), 0U);
+  size_t count = 0;
+  for (auto it = s21_mset.cbegin(); it != s21_mset.cend(); ++it) ++count;
+  ASSERT_EQ(count, s21_mset.size());
+}
+
+TEST(multiset_Compare, Greater_Order) {
+  s21::multiset<int, std::greater<int>> s21_mset = {2, 5, 2, 9, 5};
+  std::multiset<int, std::greater<int>> std_mset = {2, 5, 2, 9, 5};
+  auto std_it = std_mset.begin();
+  for (int value : s21_mset) ASSERT_EQ(value, *std_it++);
+  ASSERT_EQ(s21_mset.count(5), 2U);
+  ASSERT_EQ(*s21_mset.lower_bound(4), 2);
+  s21::multiset<int, std::greater<int>> other = {7, 2};
+  s21_mset.merge(other);
+  ASSERT_EQ(s21_mset.count(2), 3U);
+  ASSERT_EQ(*++s21_mset.begin(), 7);
+}
+
+TEST(multiset_Compare, Transparent_Lookup) {
+  s21::multiset<std::string, std::less<>> s21_mset = {"b", "a", "b", "c",
+                                                      "b"};
+  const std::string_view key = "b";
+  ASSERT_EQ(s21_mset.count(key), 3U);
+  ASSERT_TRUE(s21_mset.contains("c"));
+  ASSERT_EQ(*s21_mset.find(key), "b");
+  ASSERT_EQ(*s21_mset.upper_bound(key), "c");
+  auto range = s21_mset.equal_range("a");
+  ASSERT_EQ(++range.first, range.second);
+  ASSERT_TRUE(s21_mset.key_comp()(std::string("a"), key));
+}
+
+TEST(multiset_Modifiers, Erase_By_Key) {
+  s21::multiset<std::string, std::less<>> s21_mset = {"b", "a", "b", "c",
+                                                      "b"};
+  ASSERT_EQ(s21_mset.erase(std::string_view("b")), 3U);
+  ASSERT_EQ(s21_mset.erase("b"), 0U);
+  ASSERT_EQ(s21_mset.size(), 2U);
+  ASSERT_EQ(*s21_mset.begin(), "a");
+  ASSERT_EQ(*++s21_mset.begin(), "c");
+  s21::multiset<int> numbers = {1, 2, 2, 3, 2};
+  ASSERT_EQ(numbers.erase(2), 3U);
+  ASSERT_EQ(numbers.size(), 2U);
+  ASSERT_EQ(*--numbers.end(), 3);
+}
+
+TEST(multiset_OrderStatistic, Percentiles_And_Ranges) {
+  s21::ranked::multiset<int> s21_mset;
+  std::multiset<int> std_mset;
+  for (int i = 0; i < 1000; ++i) {
+    s21_mset.insert(i % 37);
+    std_mset.insert(i % 37);
+  }
+  s21_mset.erase(s21_mset.find(5));
+  std_mset.erase(std_mset.find(5));
+  auto std_it = std_mset.begin();
+  for (size_t k = 0; k < std_mset.size(); k += 97) {
+    std::advance(std_it, k == 0 ? 0 : 97);
+    ASSERT_EQ(*s21_mset.nth(k), *std_it);
+  }
+  ASSERT_EQ(s21_mset.rank(5),
+            static_cast<size_t>(
+                std::distance(std_mset.begin(), std_mset.lower_bound(5))));
+  ASSERT_EQ(s21_mset.count_range(5, 6), std_mset.count(5));
+  ASSERT_EQ(s21_mset.count_range(10, 20),
+            static_cast<size_t>(std::distance(std_mset.lower_bound(10),
+                                              std_mset.lower_bound(20))));
+  auto range = s21_mset.equal_range(36);
+  ASSERT_EQ(s21_mset.distance(range.first, range.second),
+            static_cast<std::ptrdiff_t>(std_mset.count(36)));
+  ASSERT_EQ(s21_mset.index(range.second), s21_mset.size());
+}
+
+TEST(multiset_OrderStatistic, Count_By_Ranks) {
+  s21::ranked::multiset<int> s21_mset;
+  for (int i = 0; i < 300; ++i) s21_mset.insert(i % 3);
+  s21_mset.erase(s21_mset.find(1));
+  ASSERT_EQ(s21_mset.count(0), 100U);
+  ASSERT_EQ(s21_mset.count(1), 99U);
+  ASSERT_EQ(s21_mset.count(3), 0U);
+  ASSERT_EQ(s21_mset.erase(2), 100U);
+  ASSERT_EQ(s21_mset.count(2), 0U);
+}
+
+TEST(counted_multiset, Matches_Multiset) {
+  s21::counted_multiset<int> s21_cset = {3, 1, 3, 2, 3, 1};
+  std::multiset<int> std_mset = {3, 1, 3, 2, 3, 1};
+  ASSERT_EQ(s21_cset.size(), 6U);
+  ASSERT_EQ(s21_cset.distinct_size(), 3U);
+  auto std_it = std_mset.begin();
+  for (int value : s21_cset) ASSERT_EQ(value, *std_it++);
+  ASSERT_EQ(std_it, std_mset.end());
+  auto it = s21_cset.end();
+  for (auto rit = std_mset.rbegin(); rit != std_mset.rend(); ++rit) {
+    ASSERT_EQ(*--it, *rit);
+  }
+  ASSERT_EQ(it, s21_cset.begin());
+  ASSERT_EQ(s21_cset.count(3), 3U);
+  ASSERT_EQ(s21_cset.count(4), 0U);
+  ASSERT_EQ(*s21_cset.upper_bound(1), 2);
+  auto range = s21_cset.equal_range(1);
+  ASSERT_EQ(*range.first, 1);
+  ASSERT_EQ(*++range.first, 1);
+  ASSERT_EQ(++range.first, range.second);
+}
+
+TEST(counted_multiset, Insert_And_Erase_Copies) {
+  s21::counted_multiset<std::string> s21_cset;
+  auto it = s21_cset.insert("b", 1000000);
+  ASSERT_EQ(*it, "b");
+  ASSERT_EQ(s21_cset.insert("b", 0), s21_cset.end());
+  s21_cset.insert("a");
+  auto last = s21_cset.insert("a");
+  ASSERT_EQ(*++last, "b");
+  ASSERT_EQ(s21_cset.size(), 1000002U);
+  ASSERT_EQ(s21_cset.distinct_size(), 2U);
+  s21_cset.erase(s21_cset.begin());
+  ASSERT_EQ(s21_cset.count("a"), 1U);
+  s21_cset.erase(s21_cset.find("a"));
+  ASSERT_FALSE(s21_cset.contains("a"));
+  ASSERT_EQ(s21_cset.erase("b"), 1000000U);
+  ASSERT_TRUE(s21_cset.empty());
+  ASSERT_EQ(s21_cset.begin(), s21_cset.end());
+}
+
+TEST(counted_multiset, Merge_Copy_And_Move) {
+  s21::counted_multiset<int> s21_cset = {1, 2, 2};
+  s21::counted_multiset<int> other = {2, 3, 3};
+  s21_cset.merge(other);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(s21_cset.size(), 6U);
+  ASSERT_EQ(s21_cset.count(2), 3U);
+  ASSERT_EQ(s21_cset.count(3), 2U);
+  s21::counted_multiset<int> copy(s21_cset);
+  s21::counted_multiset<int> moved(std::move(s21_cset));
+  ASSERT_TRUE(s21_cset.empty());
+  ASSERT_EQ(moved.size(), copy.size());
+  copy.insert_many(4, 4, 1);
+  ASSERT_EQ(copy.count(4), 2U);
+  ASSERT_EQ(copy.count(1), 2U);
+  copy.swap(moved);
+  ASSERT_EQ(copy.size(), 6U);
+  ASSERT_EQ(moved.size(), 9U);
+}
+
+TEST(counted_multiset, Bidirectional_Iterator) {
+  using traits = std::iterator_traits<s21::counted_multiset<int>::iterator>;
+  static_assert(std::is_same_v<traits::iterator_category,
+                               std::bidirectional_iterator_tag>);
+  s21::counted_multiset<int> s21_cset = {1, 3, 3, 3};
+  // Шаг назад с end() и внутри серии повторов
+  auto last = std::prev(s21_cset.end());
+  ASSERT_EQ(*last, 3);
+  ASSERT_EQ(*std::prev(last, 3), 1);
+  std::vector<int> reversed(std::make_reverse_iterator(s21_cset.end()),
+                            std::make_reverse_iterator(s21_cset.begin()));
+  ASSERT_EQ(reversed, (std::vector<int>{3, 3, 3, 1}));
+}
+
 TEST(MultisetTest, DefaultConstructor) {
   s21::multiset<int> ms;
   EXPECT_TRUE(ms.empty());
@@ -1894,6 +2093,97 @@ TEST(multiset_Lookup, Count_0) {
   ASSERT_EQ(s21_set.count(9.9), std_set.count(9.9));
 }
 
+TEST(multiset_Modifiers, Insert_Hint) {
+  s21::multiset<int> s21_set;
+  std::multiset<int> std_set;
+  auto hint = s21_set.begin();
+  for (int i = 0; i < 500; ++i) {
+    hint = s21_set.insert(hint, i / 3);  // Отсортированный поток с повторами
+    std_set.insert(i / 3);
+  }
+  s21_set.insert(s21_set.begin(), -5);
+  s21_set.emplace_hint(s21_set.find(100), 100);
+  std_set.insert(-5);
+  std_set.insert(100);
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto s21_it = s21_set.begin();
+  for (auto std_it = std_set.begin(); std_it != std_set.end(); ++std_it) {
+    ASSERT_EQ(*s21_it++, *std_it);
+  }
+}
+
+TEST(multiset_Modifiers, Pool_Allocator) {
+  s21::multiset<int, std::less<int>, s21::pool_allocator<int, 16>> s21_set;
+  std::multiset<int> std_set;
+  for (int i = 0; i < 300; ++i) {
+    s21_set.insert(i % 50);
+    std_set.insert(i % 50);
+  }
+  for (int i = 0; i < 50; i += 5) {
+    s21_set.erase(s21_set.find(i));
+    std_set.erase(std_set.find(i));
+  }
+  s21::multiset<int, std::less<int>, s21::pool_allocator<int, 16>> copy;
+  copy = s21_set;
+  s21_set.clear();
+  ASSERT_EQ(copy.size(), std_set.size());
+  auto s21_it = copy.begin();
+  for (auto std_it = std_set.begin(); std_it != std_set.end(); ++std_it) {
+    ASSERT_EQ(*s21_it++, *std_it);
+  }
+}
+
+TEST(multiset_Modifiers, Pmr_Allocator) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::pmr::multiset<int> s21_set(&resource);
+  for (int i = 0; i < 100; ++i) s21_set.insert(i % 10);
+  s21::pmr::multiset<int> moved(std::move(s21_set));
+  ASSERT_TRUE(moved.get_allocator().resource() == &resource);
+  ASSERT_EQ(moved.size(), 100U);
+  ASSERT_EQ(moved.count(3), 10U);
+}
+
+TEST(multiset_Modifiers, Move_Assign_Noexcept) {
+  // С pmr при разных ресурсах узлы переносятся с выделением памяти
+  static_assert(std::is_nothrow_move_assignable_v<s21::multiset<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::counted_multiset<int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::multiset<int>>);
+  static_assert(
+      !std::is_nothrow_move_assignable_v<s21::pmr::counted_multiset<int>>);
+}
+
+TEST(multiset_Modifiers, Const_Iterator_One_Way) {
+  using multiset = s21::multiset<int>;
+  static_assert(
+      std::is_convertible_v<multiset::iterator, multiset::const_iterator>);
+  static_assert(
+      !std::is_convertible_v<multiset::const_iterator, multiset::iterator>);
+  multiset s21_set = {1, 2, 2, 3};
+  multiset::const_iterator it = std::as_const(s21_set).find(2);
+  ASSERT_TRUE(it == s21_set.find(2));
+  s21_set.erase(it);
+  s21_set.emplace_hint(s21_set.cend(), 4);
+  ASSERT_EQ(s21_set.count(2), 1U);
+  ASSERT_EQ(s21_set.size(), 4U);
+  s21::counted_multiset<int> counted = {2, 2, 3};
+  counted.erase(counted.find(2));
+  counted.erase(counted.find(3));
+  ASSERT_EQ(counted.count(2), 1U);
+  ASSERT_EQ(counted.distinct_size(), 1U);
+}
+
+TEST(multiset_Modifiers, Emplace) {
+  s21::multiset<std::string> s21_set;
+  s21_set.emplace(2, 'a');
+  s21_set.emplace("aa");
+  std::string value = "b";
+  s21_set.insert(std::move(value));
+  s21_set.emplace_hint(s21_set.end(), "c");
+  ASSERT_EQ(s21_set.size(), 4U);
+  ASSERT_EQ(s21_set.count("aa"), 2U);
+  ASSERT_EQ(*s21_set.begin(), "aa");
+}
+
 TEST(multiset_Lookup, Count_1) {
   s21::multiset<double> s21_set = {5.5, 4.4, 5.5, 8.8, 1.1, 2.2, 3.3, 6.6};
   std::multiset<double> std_set = {5.5, 4.4, 5.5, 8.8, 1.1, 2.2, 3.3, 6.6};
@@ -1902,7 +2192,7 @@ TEST(multiset_Lookup, Count_1) {
 
 TEST(multiset_Lookup, Lower_Bound_Empty) {
   s21::multiset<double> s21_set;
-  ASSERT_EQ(s21_set.lower_bound(5.5), nullptr);
+  ASSERT_EQ(s21_set.lower_bound(5.5), s21_set.end());
 }
 
 TEST(multiset_Lookup, Lower_Bound_Begin) {
@@ -1931,12 +2221,12 @@ TEST(multiset_Lookup, Lower_Bound_End) {
 
 TEST(multiset_Lookup, Lower_Bound_Non) {
   s21::multiset<double> s21_set = {5.5, 4.4, 5.5, 8.8, 1.1, 2.2, 3.3, 5.5};
-  ASSERT_EQ(s21_set.lower_bound(9.9), nullptr);
+  ASSERT_EQ(s21_set.lower_bound(9.9), s21_set.end());
 }
 
 TEST(multiset_Lookup, Upper_Bound_Empty) {
   s21::multiset<double> s21_set;
-  ASSERT_EQ(s21_set.upper_bound(5.5), nullptr);
+  ASSERT_EQ(s21_set.upper_bound(5.5), s21_set.end());
 }
 
 TEST(multiset_Lookup, Upper_Bound_Begin) {
@@ -1959,7 +2249,7 @@ TEST(multiset_Lookup, Upper_Bound_Middle2) {
 
 TEST(multiset_Lookup, Upper_Bound_End) {
   s21::multiset<double> s21_set = {5.5, 4.4, 5.5, 8.8, 1.1, 2.2, 3.3, 5.5};
-  ASSERT_EQ(s21_set.upper_bound(8.8), nullptr);
+  ASSERT_EQ(s21_set.upper_bound(8.8), s21_set.end());
 }
 
 TEST(multiset_Lookup, Upper_Bound_Non1) {
@@ -1970,7 +2260,7 @@ TEST(multiset_Lookup, Upper_Bound_Non1) {
 
 TEST(multiset_Lookup, Upper_Bound_Non2) {
   s21::multiset<double> s21_set = {5.5, 4.4, 5.5, 8.8, 1.1, 2.2, 3.3, 5.5};
-  ASSERT_EQ(s21_set.upper_bound(9.9), nullptr);
+  ASSERT_EQ(s21_set.upper_bound(9.9), s21_set.end());
 }
 
 TEST(multiset_Lookup, Equal_Range_Empty) {
@@ -1978,8 +2268,8 @@ TEST(multiset_Lookup, Equal_Range_Empty) {
   std::pair<typename s21::multiset<double>::iterator,
             typename s21::multiset<double>::iterator>
       s21_pair = s21_set.equal_range(1.1);
-  ASSERT_EQ(s21_pair.first, nullptr);
-  ASSERT_EQ(s21_pair.second, nullptr);
+  ASSERT_EQ(s21_pair.first, s21_set.end());
+  ASSERT_EQ(s21_pair.second, s21_set.end());
 }
 
 TEST(multiset_Lookup, Equal_Range_Begin) {
@@ -2031,7 +2321,7 @@ TEST(multiset_Lookup, Equal_Range_End) {
             typename std::multiset<double>::iterator>
       std_pair = std_set.equal_range(8.8);
   ASSERT_EQ(*s21_pair.first, *std_pair.first);
-  ASSERT_EQ(s21_pair.second, nullptr);
+  ASSERT_EQ(s21_pair.second, s21_set.end());
 }
 
 TEST(multiset_Lookup, Equal_Range_Non) {
@@ -2039,8 +2329,8 @@ TEST(multiset_Lookup, Equal_Range_Non) {
   std::pair<typename s21::multiset<double>::iterator,
             typename s21::multiset<double>::iterator>
       s21_pair = s21_set.equal_range(9.9);
-  ASSERT_EQ(s21_pair.first, nullptr);
-  ASSERT_EQ(s21_pair.second, nullptr);
+  ASSERT_EQ(s21_pair.first, s21_set.end());
+  ASSERT_EQ(s21_pair.second, s21_set.end());
 }
 
 TEST(Multiset_Modifiers, Erase_SingleElement) {
@@ -2144,7 +2434,7 @@ TEST(Multiset_Modifiers, Erase_DuplicateElements) {
 
 TEST(Multiset_Erase, NullIterator) {
   s21::multiset<int> s21_set = {10, 20, 30};
-  s21::multiset<int>::iterator null_iter = nullptr;
+  s21::multiset<int>::iterator null_iter;
 
   s21_set.erase(null_iter);
 
@@ -3335,12 +3625,174 @@ TEST(MultisetTest, InsertMany_Empty) {
   EXPECT_EQ(ms.size(), 0);  // Размер множества должен быть 0
 }
 
+TEST(MultisetTest, RangeConstructor_Unsorted) {
+  std::vector<int> values;
+  for (int i = 0; i < 3000; ++i) values.push_back(i * 7919 % 500);
+  s21::multiset<int> ms(values.begin(), values.end());
+  std::multiset<int> std_ms(values.begin(), values.end());
+  ASSERT_EQ(ms.size(), std_ms.size());
+  auto it = ms.begin();
+  for (int value : std_ms) ASSERT_EQ(*it++, value);
+  ms.insert(250);
+  ASSERT_EQ(ms.count(250), 7U);
+}
+
+TEST(MultisetTest, Algebra_Counts) {
+  std::multiset<int> lhs = {1, 1, 1, 2, 3, 3, 5};
+  std::multiset<int> rhs = {1, 2, 2, 3, 3, 3, 4};
+  s21::multiset<int> s21_lhs(lhs.begin(), lhs.end());
+  s21::multiset<int> s21_rhs(rhs.begin(), rhs.end());
+  // Повторы учитываются поштучно, как в std::set_union и остальных
+  std::vector<int> expected;
+  std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                 std::back_inserter(expected));
+  s21::multiset<int> result = s21_lhs.set_union(s21_rhs);
+  ASSERT_EQ(result.size(), expected.size());
+  auto it = result.begin();
+  for (int value : expected) ASSERT_EQ(*it++, value);
+  expected.clear();
+  std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                        std::back_inserter(expected));
+  result = s21_lhs.set_intersection(s21_rhs);
+  ASSERT_EQ(result.size(), expected.size());
+  it = result.begin();
+  for (int value : expected) ASSERT_EQ(*it++, value);
+  expected.clear();
+  std::set_symmetric_difference(lhs.begin(), lhs.end(), rhs.begin(),
+                                rhs.end(), std::back_inserter(expected));
+  result = s21_lhs.set_symmetric_difference(s21_rhs);
+  ASSERT_EQ(result.size(), expected.size());
+  it = result.begin();
+  for (int value : expected) ASSERT_EQ(*it++, value);
+  ASSERT_EQ(s21_lhs.set_difference(s21_rhs).count(1), 2U);
+}
+
+TEST(MultisetTest, Merge_Steals_Nodes) {
+  s21::multiset<int> ms1 = {1, 2, 2};
+  s21::multiset<int> ms2 = {2, 3};
+  const int* three = &*ms2.find(3);
+  ms1.merge(ms2);
+  EXPECT_TRUE(ms2.empty());
+  ASSERT_EQ(ms1.size(), 5U);
+  ASSERT_EQ(ms1.count(2), 3U);
+  ASSERT_EQ(&*ms1.find(3), three);
+}
+
+TEST(MultisetTest, Merge_Large) {
+  s21::multiset<int> ms1, ms2;
+  std::multiset<int> std_ms1, std_ms2;
+  for (int i = 0; i < 2000; ++i) {
+    ms1.insert(i % 300);
+    std_ms1.insert(i % 300);
+    ms2.insert(i % 700);
+    std_ms2.insert(i % 700);
+  }
+  ms1.merge(ms2);
+  std_ms1.merge(std_ms2);
+  EXPECT_TRUE(ms2.empty());
+  ASSERT_EQ(ms1.size(), std_ms1.size());
+  auto it = ms1.begin();
+  for (int value : std_ms1) ASSERT_EQ(*it++, value);
+}
+
 TEST(Multiset_Capacity, Max_Size) {
   s21::multiset<int> s21_set = {1, 2, 3};
   std::multiset<int> std_set = {1, 2, 3};
   ASSERT_EQ(s21_set.max_size(), std_set.max_size());
 }
 
+// btree_multiset_tests
+
+TEST(BtreeMultisetTest, Matches_Std_Multiset) {
+  s21::btree_multiset<int> ms;
+  std::multiset<int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = (i * 7919) % 1000;
+    if (i % 4 == 3 && expected.count(key) != 0) {
+      ms.erase(ms.find(key));
+      expected.erase(expected.find(key));
+    } else {
+      ASSERT_EQ(*ms.insert(key), key);
+      expected.insert(key);
+    }
+  }
+  ASSERT_EQ(ms.size(), expected.size());
+  auto it = ms.begin();
+  for (int key : expected) ASSERT_EQ(*it++, key);
+  ASSERT_TRUE(it == ms.end());
+  for (int key = 0; key < 1000; key += 37) {
+    ASSERT_EQ(ms.count(key), expected.count(key));
+  }
+}
+
+TEST(BtreeMultisetTest, Equal_Range_Order) {
+  s21::btree_multiset<std::string> ms = {"b", "a", "b", "c", "b"};
+  auto range = ms.equal_range("b");
+  int count = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    ASSERT_EQ(*it, "b");
+    ++count;
+  }
+  ASSERT_EQ(count, 3);
+  ASSERT_EQ(*range.second, "c");
+  // Вставка с подсказкой встает перед ней, если порядок не нарушается
+  ms.insert(ms.find("c"), "b");
+  ASSERT_EQ(ms.count("b"), 4U);
+  s21::btree_multiset<std::string> other = {"a", "d"};
+  ms.merge(other);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(ms.count("a"), 2U);
+  ASSERT_EQ(*--ms.end(), "d");
+}
+
+TEST(BtreeMultisetTest, Insert_Own_Element) {
+  using multiset_type = s21::btree_multiset<std::string>;
+  multiset_type ms;
+  for (int i = 0; i < multiset_type::kSlots; ++i) {
+    ms.insert("a-long-string-outside-sso-" + std::to_string(100 + i));
+  }
+  // Лист заполнен: элемент копируется до деления узла
+  const std::string last = *std::prev(ms.end());
+  ms.insert(*std::prev(ms.end()));
+  ASSERT_EQ(ms.count(last), 2U);
+  ASSERT_EQ(*std::prev(ms.end()), last);
+  ms.insert(*ms.begin());
+  ASSERT_EQ(ms.count(*ms.begin()), 2U);
+  ASSERT_TRUE(std::is_sorted(ms.begin(), ms.end()));
+}
+
+// flat_multiset_tests
+
+TEST(FlatMultisetTest, Matches_Std_Multiset) {
+  std::vector<int> input;
+  for (int i = 0; i < 600; ++i) input.push_back(i * 7919 % 100);
+  s21::flat_multiset<int> s(input.begin(), input.end());
+  std::multiset<int> expected(input.begin(), input.end());
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+  s.insert(input.begin(), input.begin() + 100);
+  expected.insert(input.begin(), input.begin() + 100);
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+  for (int key = -1; key <= 100; ++key) {
+    ASSERT_EQ(s.count(key), expected.count(key));
+  }
+  s.erase(s.find(42));
+  ASSERT_EQ(s.count(42), 6U);
+}
+
+TEST(FlatMultisetTest, Equal_Range_Order) {
+  s21::flat_multiset<int> s = {3, 1, 3, 2, 3};
+  auto range = s.equal_range(3);
+  ASSERT_EQ(range.second - range.first, 3);
+  ASSERT_EQ(range.second, s.end());
+  auto results = s.insert_many(3, 0, 3);
+  ASSERT_TRUE(results[0].second && results[1].second && results[2].second);
+  // Новые эквивалентные элементы встают после имеющихся
+  ASSERT_EQ(results[0].first - s.begin(), 6);
+  ASSERT_EQ(results[2].first - s.begin(), 7);
+  ASSERT_EQ(s.count(3), 5U);
+}
+
 // array_tests
 
 TEST(Array_Constructor, Default_Empty) {
@@ -0,0 +1,62 @@
+#ifndef S21_FLAT_MAP_H_
+#define S21_FLAT_MAP_H_
+
+#include <memory>  // For std::allocator
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>    // For std::forward_as_tuple
+#include <utility>  // For std::piecewise_construct
+
+#include "s21_flat_tree.h"
+
+namespace s21 {
+
+// Словарь в упорядоченном векторе с тем же интерфейсом, что у s21::map.
+// Элементы сдвигаются внутри вектора присваиванием, поэтому пары хранятся
+// как std::pair<Key, T> с изменяемым ключом (как в boost::container);
+// менять ключ через итератор нельзя - это нарушит порядок
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
+class flat_map : public flat_tree<flat_params<Key, std::pair<Key, T>,
+                                              tree_key_first, false,
+                                              Allocator>> {
+  using base = flat_tree<
+      flat_params<Key, std::pair<Key, T>, tree_key_first, false, Allocator>>;
+
+ public:
+  using mapped_type = T;
+  using typename base::iterator;
+  using typename base::value_type;
+
+  using base::base;
+
+  T& at(const Key& key);
+  T& operator[](const Key& key);
+  T& operator[](Key&& key);
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, T&& obj);
+  std::pair<iterator, bool> insert_or_assign(Key&& key, T&& obj);
+  // Пара создается, только если ключа еще нет
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+
+ private:
+  template <typename K, typename M>
+  std::pair<iterator, bool> assign_key(K&& key, M&& obj);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(K&& key, Args&&... args);
+};
+
+namespace pmr {
+template <typename Key, typename T>
+using flat_map =
+    s21::flat_map<Key, T, std::pmr::polymorphic_allocator<std::pair<Key, T>>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#include "s21_flat_map.inc"
+#endif  // S21_FLAT_MAP_H_
@@ -0,0 +1,25 @@
+#ifndef S21_FLAT_SET_H_
+#define S21_FLAT_SET_H_
+
+#include <memory>  // For std::allocator
+#include <memory_resource>
+
+#include "s21_flat_tree.h"
+
+namespace s21 {
+
+// Множество в упорядоченном векторе с тем же интерфейсом поиска, что у
+// s21::set. Подходит для таблиц, которые собираются один раз (конструктор
+// из диапазона, insert(first, last)) и потом в основном читаются
+template <typename T, typename Allocator = std::allocator<T>>
+using flat_set =
+    flat_tree<flat_params<T, T, tree_key_identity, false, Allocator>>;
+
+namespace pmr {
+template <typename Key>
+using flat_set = s21::flat_set<Key, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // S21_FLAT_SET_H_
@@ -0,0 +1,157 @@
+#ifndef S21_FLAT_TREE_H_
+#define S21_FLAT_TREE_H_
+
+#include <algorithm>  // For std::stable_sort, std::is_sorted
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>  // For std::allocator_traits
+#include <type_traits>
+#include <utility>  // For std::forward, std::move_if_noexcept
+
+#include "s21_tree.h"  // For tree_key_identity, tree_key_first
+#include "s21_vector.h"
+
+namespace s21 {
+
+template <typename Key, typename Value, typename KeyOf, bool Multi,
+          typename Allocator>
+struct flat_params {
+  using key_type = Key;
+  using value_type = Value;
+  using key_of = KeyOf;
+  using allocator_type = Allocator;
+  static constexpr bool multi = Multi;
+};
+
+// Общая основа flat_set, flat_map и flat_multiset: элементы лежат в одном
+// s21::vector по возрастанию ключа, поиск - двоичный. Для таблиц, которые
+// строятся один раз и потом в основном читаются, это компактнее и быстрее
+// дерева: нет узлов и указателей, обход идет по непрерывной памяти.
+// Одиночная вставка и удаление сдвигают хвост вектора и стоят O(n), поэтому
+// данные лучше добавлять пачками: конструктор из диапазона и
+// insert(first, last) сортируют новые элементы один раз и сливают их с
+// имеющимися за O(n + m). Итераторы - указатели на элементы; любая вставка
+// или удаление делают их недействительными.
+// Параметры собраны в flat_params так же, как у btree
+template <typename Params>
+class flat_tree {
+  using Key = typename Params::key_type;
+  using Value = typename Params::value_type;
+  using KeyOf = typename Params::key_of;
+  using Allocator = typename Params::allocator_type;
+  static constexpr bool Multi = Params::multi;
+
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using allocator_type = Allocator;
+  using container_type = vector<Value, Allocator>;
+  using iterator = Value*;
+
+  // Вставка уникального ключа возвращает пару (позиция, вставлен ли
+  // элемент), вставка в мультимножество - только позицию
+  using insert_return_type =
+      std::conditional_t<Multi, iterator, std::pair<iterator, bool>>;
+
+  flat_tree();
+  explicit flat_tree(const Allocator& alloc);
+  flat_tree(std::initializer_list<value_type> const& items);
+  // Элементы в любом порядке: сортируются один раз, повторы ключей
+  // отбрасываются (остается первый)
+  template <typename InputIt>
+  flat_tree(InputIt first, InputIt last);
+  // Забирает готовый вектор и упорядочивает его на месте
+  explicit flat_tree(container_type&& items);
+  flat_tree(const flat_tree& other);
+  flat_tree(const flat_tree& other, const Allocator& alloc);
+  flat_tree(flat_tree&& other) noexcept;
+  ~flat_tree();
+
+  flat_tree& operator=(const flat_tree& other);
+  flat_tree& operator=(flat_tree&& other) noexcept(
+      allocator_always_steals<Allocator>::value);
+
+  allocator_type get_allocator() const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const noexcept;
+  size_type size() const;
+  size_type max_size() const noexcept;
+  size_type capacity() const;
+  void reserve(size_type count);
+
+  void clear();
+  insert_return_type insert(const value_type& value);
+  insert_return_type insert(value_type&& value);
+  // Вставка с подсказкой: hint - позиция, перед которой ожидается элемент.
+  // При верной подсказке двоичный поиск не нужен
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  // Пакетная вставка: O(m log m + n) вместо m сдвигов хвоста
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <typename... Args>
+  insert_return_type emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
+  void erase(iterator pos);
+  void swap(flat_tree& other);
+  void merge(flat_tree& other);
+
+  bool contains(const Key& key) const;
+  iterator find(const Key& key) const;
+  size_type count(const Key& key) const;
+  iterator lower_bound(const Key& key) const;
+  iterator upper_bound(const Key& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key) const;
+
+  // Все элементы вставляются одним слиянием, как в insert(first, last)
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+ protected:
+  // Место для ключа: существующий элемент с таким ключом (found) либо
+  // позиция, перед которой ключ вставляется
+  struct insert_pos {
+    iterator pos;
+    bool found;
+  };
+
+  insert_pos unique_pos(const Key& key) const;
+  // Верна ли подсказка: элемент с ключом key встает прямо перед hint
+  bool hint_fits(iterator hint, const Key& key) const;
+  // Создает элемент из args перед pos и возвращает его позицию
+  template <typename... Args>
+  iterator insert_at(iterator pos, Args&&... args);
+
+ private:
+  // Результат слияния для одного элемента пачки: номер элемента в векторе
+  // и вставлен ли он (false - ключ уже был)
+  using batch_result = std::pair<size_type, bool>;
+
+  template <typename V>
+  insert_return_type insert_value(V&& value);
+  template <typename V>
+  iterator insert_value(iterator hint, V&& value);
+  // Упорядочивает вектор на месте и убирает повторы ключей
+  static void sort_unique(container_type& items);
+  // Сливает пачку элементов в любом порядке с вектором за
+  // O(m log m + n + m). Если results не nullptr, в него записывается
+  // результат для каждого элемента пачки в исходном порядке
+  void merge_batch(container_type& batch, vector<batch_result>* results);
+
+  // mutable: как и у set, итераторы константного контейнера позволяют
+  // менять элементы
+  mutable container_type data_;
+};
+
+}  // namespace s21
+
+#include "s21_flat_tree.inc"
+#endif  // S21_FLAT_TREE_H_
@@ -0,0 +1,391 @@
+#ifndef S21_HASH_TABLE_H_
+#define S21_HASH_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>  // For std::memcpy
+#include <initializer_list>
+#include <iterator>
+#include <memory>  // For std::allocator_traits
+#include <stdexcept>
+#include <tuple>  // For std::forward_as_tuple
+#include <type_traits>
+#include <utility>  // For std::forward
+
+#include "s21_allocator.h"
+#include "s21_vector.h"
+
+// Группа байтов состояния сравнивается с искомым за одну команду SSE2.
+// S21_HASH_PORTABLE_GROUP включает переносимую версию на 64-битных словах
+#if defined(__SSE2__) && !defined(S21_HASH_PORTABLE_GROUP)
+#include <emmintrin.h>
+#define S21_HASH_SSE2 1
+#endif
+
+namespace s21 {
+
+// Позиции совпадений в группе. На каждую ячейку приходится 1 << Shift бит
+// маски: один бит у SSE2 и старший бит байта у переносимой версии
+template <typename Word, int Width, int Shift>
+class hash_bitmask {
+ public:
+  explicit hash_bitmask(Word mask) : mask_(mask) {}
+
+  explicit operator bool() const { return mask_ != 0; }
+  // Номер первой ячейки из маски; маска не пуста
+  int lowest() const { return trailing_zeros(); }
+  void clear_lowest() { mask_ &= mask_ - 1; }
+  // Число ячеек до первой (последней) из маски; маска не пуста
+  int trailing_zeros() const {
+    return __builtin_ctzll(static_cast<unsigned long long>(mask_)) >> Shift;
+  }
+  int leading_zeros() const {
+    constexpr int kUnused = 64 - (Width << Shift);
+    return (__builtin_clzll(static_cast<unsigned long long>(mask_)) -
+            kUnused) >>
+           Shift;
+  }
+
+ private:
+  Word mask_;
+};
+
+// Байты состояния ячеек. У занятой ячейки это 7 младших бит хеша (H2), у
+// остальных - отрицательные значения ниже
+struct hash_ctrl {
+  using type = signed char;
+  static constexpr type kEmpty = -128;
+  static constexpr type kDeleted = -2;
+  static constexpr type kSentinel = -1;  // Конец таблицы для итераторов
+
+  static bool is_full(type ctrl) { return ctrl >= 0; }
+};
+
+#ifdef S21_HASH_SSE2
+// Группа из 16 байтов состояния, загруженных в регистр SSE2
+class hash_group {
+ public:
+  static constexpr int kWidth = 16;
+  using mask = hash_bitmask<std::uint32_t, kWidth, 0>;
+
+  explicit hash_group(const hash_ctrl::type* pos)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+  mask match(hash_ctrl::type h2) const {
+    return mask(movemask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+  }
+  mask match_empty() const { return match(hash_ctrl::kEmpty); }
+  mask match_empty_or_deleted() const {
+    return mask(movemask(
+        _mm_cmpgt_epi8(_mm_set1_epi8(hash_ctrl::kSentinel), ctrl_)));
+  }
+  // Сколько ячеек подряд с начала группы свободны или удалены
+  int count_leading_empty_or_deleted() const {
+    const std::uint32_t empty_or_deleted = movemask(
+        _mm_cmpgt_epi8(_mm_set1_epi8(hash_ctrl::kSentinel), ctrl_));
+    const std::uint32_t taken = ~empty_or_deleted & 0xFFFFu;
+    return taken == 0 ? kWidth : mask(taken).trailing_zeros();
+  }
+
+ private:
+  static std::uint32_t movemask(__m128i bytes) {
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+  }
+
+  __m128i ctrl_;
+};
+#else
+// Группа из 8 байтов состояния в одном 64-битном слове: сравнения идут
+// сразу по всем байтам арифметикой над словом
+class hash_group {
+ public:
+  static constexpr int kWidth = 8;
+  using mask = hash_bitmask<std::uint64_t, kWidth, 3>;
+
+  explicit hash_group(const hash_ctrl::type* pos) : ctrl_(0) {
+    // Байт i всегда попадает в биты [8i, 8i + 8) независимо от порядка
+    // байтов платформы
+    for (int i = 0; i < kWidth; ++i) {
+      ctrl_ |= static_cast<std::uint64_t>(static_cast<unsigned char>(pos[i]))
+               << (8 * i);
+    }
+  }
+
+  // Возможны ложные совпадения в байте сразу за настоящим; найденные
+  // ячейки все равно проверяются сравнением ключей
+  mask match(hash_ctrl::type h2) const {
+    const std::uint64_t x =
+        ctrl_ ^ (kLsbs * static_cast<unsigned char>(h2));
+    return mask((x - kLsbs) & ~x & kMsbs);
+  }
+  // kEmpty = 0b10000000: старший бит есть, бита 1 нет
+  mask match_empty() const { return mask(ctrl_ & (~ctrl_ << 6) & kMsbs); }
+  // kEmpty и kDeleted = 0b11111110: старший бит есть, бита 0 нет
+  mask match_empty_or_deleted() const {
+    return mask(ctrl_ & (~ctrl_ << 7) & kMsbs);
+  }
+  int count_leading_empty_or_deleted() const {
+    const std::uint64_t taken = ~(ctrl_ & (~ctrl_ << 7)) & kMsbs;
+    return taken == 0 ? kWidth : mask(taken).trailing_zeros();
+  }
+
+ private:
+  static constexpr std::uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr std::uint64_t kMsbs = 0x8080808080808080ULL;
+
+  std::uint64_t ctrl_;
+};
+#endif
+
+template <typename Key, typename Value, typename KeyOf, typename Hash,
+          typename KeyEqual, typename Allocator>
+struct hash_params {
+  using key_type = Key;
+  using value_type = Value;
+  using key_of = KeyOf;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+};
+
+// Общая основа unordered_set и unordered_map: хеш-таблица с открытой
+// адресацией по схеме Swiss table. Элементы лежат прямо в массиве ячеек,
+// рядом - массив байтов состояния: свободна, удалена или занята (тогда в
+// байте 7 бит хеша, H2). Остальные биты хеша (H1) выбирают начальную
+// группу. Поиск сравнивает H2 сразу с целой группой байтов и сравнивает
+// ключи только у совпавших ячеек; почти всегда это одна ячейка в первой
+// же группе. Число ячеек - 2^k - 1, после последнего байта состояния идет
+// kSentinel и копия первых kWidth - 1 байтов, чтобы группу можно было
+// прочитать с любой позиции.
+// Удаление не сдвигает элементы: ячейка помечается удаленной, и итераторы
+// на остальные элементы остаются верными. Вставка может перестроить
+// таблицу; тогда недействительны все итераторы и ссылки.
+// Перемещающий конструктор элемента не должен бросать исключений
+template <typename Params>
+class hash_table {
+  using Key = typename Params::key_type;
+  using Value = typename Params::value_type;
+  using KeyOf = typename Params::key_of;
+  using Hash = typename Params::hasher;
+  using KeyEqual = typename Params::key_equal;
+  using Allocator = typename Params::allocator_type;
+  using ctrl_t = hash_ctrl::type;
+
+  static_assert(const_key_pair<Value>::nothrow_relocate,
+                "hash_table elements must be nothrow move constructible");
+
+  // Разнородный поиск (по string_view в таблице строк и т. п.) доступен,
+  // если Hash и KeyEqual объявляют is_transparent
+  template <typename H, typename E>
+  using transparent =
+      std::void_t<typename H::is_transparent, typename E::is_transparent>;
+
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using allocator_type = Allocator;
+
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    iterator();
+
+    reference operator*() const;
+    pointer operator->() const;
+    iterator& operator++();
+    iterator operator++(int);
+    bool operator==(const iterator& other) const;
+    bool operator!=(const iterator& other) const;
+
+   private:
+    friend class hash_table;
+    iterator(ctrl_t* ctrl, Value* slot);
+    // Пропускает свободные и удаленные ячейки; kSentinel останавливает
+    void skip_empty_or_deleted();
+
+    ctrl_t* ctrl_;
+    Value* slot_;
+  };
+
+  hash_table();
+  explicit hash_table(size_type bucket_count, const Hash& hash = Hash(),
+                      const KeyEqual& equal = KeyEqual(),
+                      const Allocator& alloc = Allocator());
+  explicit hash_table(const Allocator& alloc);
+  hash_table(std::initializer_list<value_type> const& items);
+  hash_table(const hash_table& other);
+  hash_table(const hash_table& other, const Allocator& alloc);
+  hash_table(hash_table&& other) noexcept;
+  ~hash_table();
+
+  hash_table& operator=(const hash_table& other);
+  hash_table& operator=(hash_table&& other) noexcept(
+      allocator_always_steals<Allocator>::value);
+
+  allocator_type get_allocator() const;
+  hasher hash_function() const;
+  key_equal key_eq() const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const noexcept;
+  size_type size() const;
+  size_type max_size() const noexcept;
+
+  // Уничтожает элементы, ячейки остаются за таблицей
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  // Элемент создается из args во временном объекте и переносится в ячейку
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const Key& key);
+  void swap(hash_table& other);
+
+  bool contains(const Key& key) const;
+  iterator find(const Key& key) const;
+  size_type count(const Key& key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = transparent<H, E>>
+  bool contains(const K& key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = transparent<H, E>>
+  iterator find(const K& key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = transparent<H, E>>
+  size_type count(const K& key) const;
+
+  // Число ячеек таблицы
+  size_type bucket_count() const noexcept;
+  float load_factor() const noexcept;
+  // Доля ячеек, которую можно занять до перестройки, из (0, 1]. По
+  // умолчанию 7/8: при групповом поиске таблица остается быстрой и почти
+  // заполненной. Новое значение сразу перестраивает таблицу
+  float max_load_factor() const noexcept;
+  void max_load_factor(float load);
+  // Перестраивает таблицу не меньше чем на count ячеек (и не меньше, чем
+  // нужно текущим элементам); удаленные ячейки освобождаются
+  void rehash(size_type count);
+  // Готовит место для count элементов без перестроек
+  void reserve(size_type count);
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+ protected:
+  // Ячейка для ключа: найденный элемент (found) либо свободная ячейка, куда
+  // его можно вставить, и хеш ключа. index == capacity_ - свободных ячеек
+  // нет, и insert_at перестроит таблицу
+  struct insert_pos {
+    size_type index;
+    bool found;
+    std::size_t hash;
+  };
+
+  template <typename K>
+  insert_pos find_or_prepare_insert(const K& key);
+  // Создает элемент из args в найденной ячейке. Если таблицу нужно
+  // перестроить, элемент создается раньше: args могут ссылаться на
+  // элементы таблицы
+  template <typename... Args>
+  iterator insert_at(const insert_pos& pos, Args&&... args);
+  iterator iterator_at(size_type index) const;
+
+ private:
+  static constexpr float kDefaultMaxLoad = 0.875f;
+
+  // Последовательность групп для поиска: смещения растут на kWidth, 2 *
+  // kWidth, ... и при числе ячеек 2^k - 1 обходят всю таблицу
+  class probe_seq {
+   public:
+    probe_seq(std::size_t hash, size_type mask);
+    size_type offset(int i = 0) const;
+    void next();
+
+   private:
+    size_type mask_;
+    size_type offset_;
+    size_type index_;
+  };
+
+  // Байты состояния пустой таблицы без ячеек: поиск сразу видит
+  // свободную ячейку, обход - конец таблицы
+  static ctrl_t* empty_group() noexcept;
+  // std::hash для целых - тождественная функция: перемешиваем биты, чтобы
+  // и H1, и H2 зависели от всего ключа
+  template <typename K>
+  std::size_t hash_of(const K& key) const;
+  static ctrl_t h2_of(std::size_t hash) noexcept;
+  static std::size_t h1_of(std::size_t hash) noexcept;
+
+  template <typename K>
+  size_type find_index(const K& key) const;
+  // Первая свободная или удаленная ячейка на пути поиска
+  size_type find_first_non_full(std::size_t hash) const;
+  // Записывает байт состояния и его копию после kSentinel
+  void set_ctrl(size_type index, ctrl_t value) noexcept;
+  void erase_at(size_type index);
+  template <typename V>
+  std::pair<iterator, bool> insert_value(V&& value);
+
+  // Сколько элементов помещается в capacity ячеек при max_load_factor_.
+  // Хотя бы одна ячейка всегда остается свободной, иначе поиск
+  // отсутствующего ключа не остановится
+  size_type growth_for(size_type capacity) const noexcept;
+  // Наименьшее допустимое число ячеек для count элементов
+  size_type capacity_for(size_type count) const noexcept;
+  // Место для вставки нового элемента с данным хешем; capacity_, если
+  // свободных ячеек не осталось и таблицу нужно перестроить
+  size_type prepare_insert(std::size_t hash) const;
+  void rehash_and_grow();
+  // Переносит элементы в таблицу из new_capacity ячеек
+  void resize(size_type new_capacity);
+  // Выделяет и размечает пустые массивы без переноса элементов
+  void allocate_storage(size_type capacity);
+  void deallocate_storage(ctrl_t* ctrl, Value* slots,
+                          size_type capacity) noexcept;
+  void destroy_elements() noexcept;
+  // Уничтожает элементы, освобождает ячейки и оставляет таблицу пустой
+  void release_storage() noexcept;
+  void relocate(Value* dst, Value* src) noexcept;
+  // Копирует элементы other в пустую таблицу
+  void copy_elements(const hash_table& other);
+  // Обмен таблицами без учета аллокаторов
+  void swap_storage(hash_table& other) noexcept;
+
+  using ctrl_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<ctrl_t>;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  // Ячейки переносятся при перестройке. Если это допустимо, перенос
+  // побайтный; иначе - перемещение с разрушением источника
+  static constexpr bool kBitwise = is_trivially_relocatable<Value>::value &&
+                                   allocator_is_plain<Allocator>::value;
+
+  Allocator alloc_;
+  Hash hash_;
+  KeyEqual equal_;
+  ctrl_t* ctrl_;
+  Value* slots_;
+  size_type capacity_;
+  size_type size_;
+  size_type growth_left_;  // Сколько еще свободных ячеек можно занять
+  float max_load_factor_;
+};
+
+}  // namespace s21
+
+#include "s21_hash_table.inc"
+#endif  // S21_HASH_TABLE_H_
@@ -1,30 +1,45 @@
 #ifndef SRC_S21_LIST_H_
 #define SRC_S21_LIST_H_
 
+#include <functional>  // For std::less
 #include <initializer_list>
 #include <iostream>
 #include <limits>
 #include <memory>  // For std::allocator_traits
+#include <memory_resource>
+#include <type_traits>
+#include <utility>  // For std::forward
 
-namespace s21 {
+#include "s21_allocator.h"
 
-template <typename T>
+namespace s21 {
 
+// Узлы списка, включая ограничитель end_, выделяются через Allocator
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
  private:
   struct Node {
     value_type data;
     Node* next;
     Node* prev;
-    Node(const value_type& value) : data(value), next(nullptr), prev(nullptr) {}
+    // Значение создается прямо в узле из аргументов insert/emplace
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
   };
 
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
   Node* head_;
   Node* tail_;
   Node* end_;
@@ -32,6 +47,7 @@ class list {
 
  public:
   list();             // default constructor, creates empty list
+  explicit list(const Allocator& alloc);  // empty list using given allocator
   list(size_type n);  // parameterized constructor, creates the list of size n
   list(std::initializer_list<value_type> const&
            items);  // initializer list constructor, creates list initizialized
@@ -41,12 +57,12 @@ class list {
   ~list();                  // destructor
 
   list& operator=(const list& l);
-  list& operator=(list&& l) noexcept;
+  list& operator=(list&& l) noexcept(allocator_always_steals<Allocator>::value);
 
   class ListIterator {
    private:
     Node* ptr_ = nullptr;
-    friend class list<value_type>;
+    friend class list;
 
    public:
     ListIterator();
@@ -70,6 +86,8 @@ class list {
   using iterator = ListIterator;
   using const_iterator = ListConstIterator;
 
+  allocator_type get_allocator() const;
+
   // Element access
   const_reference front();
   const_reference back();
@@ -86,17 +104,38 @@ class list {
   // Modifiers
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
   void pop_back();
   void push_front(const_reference value);
+  void push_front(value_type&& value);
   void pop_front();
+  // Элемент создается прямо в узле из args
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
   void swap(list& other);
+  // merge, splice и reverse перевязывают узлы без выделения памяти и
+  // копирования элементов (при разных аллокаторах элементы перемещаются)
   void merge(list& other);
+  template <typename Compare>
+  void merge(list& other, Compare comp);
   void splice(const_iterator pos, list& other);
+  void splice(const_iterator pos, list& other, const_iterator it);
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last);
   void reverse();
   void unique();
+  // Устойчивая сортировка слиянием: узлы перевязываются, элементы не
+  // копируются и память не выделяется
   void sort();
+  template <typename Compare>
+  void sort(Compare comp);
 
   // Containersplus
   template <class... Args>
@@ -108,8 +147,32 @@ class list {
 
  private:  // Utils
   void change_end();
+  // Вставляет готовый узел перед next (nullptr или end_ - в конец)
+  void link_before(Node* next, Node* node);
+  // Исключает из списка цепочку [first, last] из count узлов
+  void unlink_range(Node* first, Node* last, size_type count);
+  // Переносит цепочку [first, last] из other перед pos
+  void transfer(Node* pos, list& other, Node* first, Node* last,
+                size_type count);
+  // Ограничитель end_: для арифметических T хранит размер списка (как
+  // заголовок std::list), для остальных типов - значение по умолчанию
+  Node* create_sentinel();
+  template <typename... Args>
+  Node* create_node(Args&&... args);
+  void destroy_node(Node* node);
+  // Сливает отсортированные цепочки по next в first. Если comp бросит
+  // исключение, в first окажутся все узлы обеих цепочек
+  template <typename Compare>
+  static void merge_runs(Node*& first, Node* second, Compare& comp);
+  // Делает цепочку по next содержимым списка, восстанавливая prev
+  void adopt_chain(Node* first);
 };
 
+namespace pmr {
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #include "s21_list.inc"  // Здесь подключается файл с реализацией методов
@@ -1,15 +1,29 @@
 #ifndef S21_MAP_H_
 #define S21_MAP_H_
 
-#include <memory>  // For std::allocator_traits
+#include <functional>  // For std::less
+#include <iterator>    // For std::bidirectional_iterator_tag
+#include <memory>      // For std::allocator_traits
+#include <memory_resource>
 #include <stdexcept>
+#include <tuple>  // For std::forward_as_tuple
+#include <type_traits>
+#include <utility>  // For std::piecewise_construct
 
+#include "s21_allocator.h"
 #include "s21_stack.h"
+#include "s21_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename T>
-class map {
+// Compare задает порядок ключей, а Allocator выделяет узлы дерева, как и у
+// set. Ranked включает порядковую статистику, тоже как у set
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>,
+          bool Ranked = false>
+class map : private tree_compare<Compare> {
+  using compare_base = tree_compare<Compare>;
+
  public:
   using size_type = std::size_t;  // Определение size_type как std::size_t
   using mapped_type = T;
@@ -17,61 +31,126 @@ class map {
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type&;
   using const_reference = const reference;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+
+  // Сравнение пар по ключам
+  class value_compare {
+   public:
+    bool operator()(const value_type& lhs, const value_type& rhs) const;
+
+   private:
+    explicit value_compare(const Compare& comp);
+
+    Compare comp_;
+    friend class map;
+  };
 
  private:
-  enum Color { RED, BLACK, END };
+  enum Color { RED, BLACK };
 
-  struct Node {
+  struct Node : tree_rank<Ranked> {
     value_type value;
     Node* left;
     Node* right;
     Node* parent;
     Color color;
 
-    Node(const value_type& val, Color c, Node* p)
-        : value(val), left(nullptr), right(nullptr), parent(p), color(c) {}
+    // Пара создается прямо в узле из аргументов insert/emplace
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : value(std::forward<Args>(args)...),
+          left(nullptr),
+          right(nullptr),
+          parent(nullptr),
+          color(RED) {}
   };
 
+  using lookup = tree_lookup<Node, tree_key_first, Compare>;
+  using insert_pos = tree_insert_pos<Node>;
+  using builder = tree_builder<Node, tree_key_first, Compare>;
+  using chain = tree_chain<Node>;
+  using order = tree_order<Node, tree_key_first, Compare>;
+  using compare_base::comp;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
   Node* root_;
+  // Крайние узлы дерева: begin() за O(1) и вставка в конец за O(1).
+  // Позиция end() - nullptr, поэтому end() ничего не вычисляет и не
+  // пишет в узлы, и константное дерево можно читать из нескольких потоков
+  Node* leftmost_;
+  Node* rightmost_;
   size_type size_;
 
   // Внутренний класс итератора
  public:
-  class iterator {
+  // Итератор только для чтения. iterator наследуется от него, поэтому
+  // iterator приводится к const_iterator, а обратного приведения нет
+  class const_iterator {
    public:
-    using iterator_category = std::forward_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename map::value_type;
     using difference_type = std::ptrdiff_t;
-    using pointer = T*;
+    using pointer = const value_type*;
+    using reference = const value_type&;
 
-    // Конструкторы
-    iterator();
-    iterator(Node* node);
-    iterator(const iterator& other);
+    // Конструктор
+    const_iterator();
 
     // Операторы разыменования
-    value_type& operator*();
+    const value_type& operator*() const;
     // Оператор инкремента
+    const_iterator& operator++();
+    const_iterator operator++(int);
+    // Оператор декремента
+    const_iterator& operator--();
+    const_iterator operator--(int);
+    // Оператор сравнения
+    bool operator==(const const_iterator& other) const;
+    bool operator!=(const const_iterator& other) const;
+
+   protected:
+    const_iterator(Node* node, const map* tree);
+
+    Node* current_;  // Текущий узел; nullptr - позиция end()
+    // Дерево итератора: с end() шаг назад ведет к его максимуму
+    const map* tree_;
+    friend class map;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    iterator();
+
+    value_type& operator*();
     iterator& operator++();
     iterator operator++(int);
-    // Оператор декремента
     iterator& operator--();
     iterator operator--(int);
-    // Оператор сравнения
-    bool operator==(const iterator& other) const;
-    bool operator!=(const iterator& other) const;
-    iterator& operator=(const iterator& other);
 
    private:
-    Node* current_;  // Указатель на текущий узел
+    iterator(Node* node, const map* tree);
     friend class map;
-    Node* find_min(Node* node);
-    Node* find_max(Node* node);
   };
 
   // Constructors
   map();
+  explicit map(const Allocator& alloc);
+  explicit map(const Compare& comp, const Allocator& alloc = Allocator());
   map(std::initializer_list<value_type> const& items);
+  // Элементы в любом порядке. Упорядоченный диапазон превращается в дерево
+  // за O(n), остальной сортируется один раз; из повторов ключа остается
+  // первый
+  template <typename InputIt>
+  map(InputIt first, InputIt last, const Compare& comp = Compare());
   map(const map& m);
+  map(const map& m, const Allocator& alloc);
   map(map&& m) noexcept;
 
   // Destructor
@@ -81,14 +160,31 @@ class map {
   // копирование
   map& operator=(const map& m);
   // перемещение
-  map& operator=(map&& m) noexcept;
+  map& operator=(map&& m) noexcept(allocator_always_steals<Allocator>::value);
 
   T& at(const Key& key);
+  const T& at(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  T& at(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  const T& at(const K& key) const;
   T& operator[](const Key& key);
+  T& operator[](Key&& key);
+
+  allocator_type get_allocator() const;
+  key_compare key_comp() const;
+  value_compare value_comp() const;
 
   // Iterators
-  iterator begin() const;
-  iterator end() const;
+  // Константные методы ничего не пишут в дерево и не выделяют память,
+  // поэтому константный контейнер можно читать из нескольких потоков
+  // без блокировок
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
 
   // Capacity
   bool empty() const noexcept;
@@ -98,13 +194,91 @@ class map {
   // Modifiers
   void clear();
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  // Вставка с подсказкой: hint - позиция, перед которой ожидается элемент
+  iterator insert(const_iterator hint, const value_type& value);
+  iterator insert(const_iterator hint, value_type&& value);
+  // Пара создается в узле из args. Ключ известен только после создания
+  // узла, поэтому при повторе ключа узел сразу освобождается
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
+  // Значение создается из args, только если ключа еще нет
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
   std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
-  void erase(iterator pos);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, T&& obj);
+  std::pair<iterator, bool> insert_or_assign(Key&& key, T&& obj);
+  void erase(const_iterator pos);
+  // Удаляет элемент с ключом key и возвращает число удаленных (0 или 1).
+  // Итераторы обоих видов уходят в erase(const_iterator)
+  size_type erase(const Key& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<K, const_iterator>>>
+  size_type erase(const K& key);
   void swap(map& other);
+  // Узлы other переходят в дерево без копирования, если память выделена
+  // равными аллокаторами; иначе элементы копируются. O(n + m)
   void merge(map& other);
+  // Операции над множествами по двум упорядоченным последовательностям за
+  // O(n + m), см. tree_builder::combine. Результат - новое сбалансированное
+  // дерево с аллокатором, выбранным как при копировании *this
+  map set_union(const map& other) const;
+  map set_intersection(const map& other) const;
+  map set_difference(const map& other) const;
+  map set_symmetric_difference(const map& other) const;
 
   // Lookup
+  // Перегрузки с шаблонным K, как и у set, доступны только для прозрачного
+  // компаратора и ищут ключ без временного Key
   bool contains(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  bool contains(const K& key) const;
+  size_type count(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  size_type count(const K& key) const;
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  iterator find(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  const_iterator find(const K& key) const;
+  iterator lower_bound(const Key& key);
+  const_iterator lower_bound(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  iterator lower_bound(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  const_iterator lower_bound(const K& key) const;
+  iterator upper_bound(const Key& key);
+  const_iterator upper_bound(const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  iterator upper_bound(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  const_iterator upper_bound(const K& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key);
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key& key) const;
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  std::pair<iterator, iterator> equal_range(const K& key);
+  template <typename K, typename C = Compare, typename = tree_transparent<C>>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const;
+
+  // Order statistic, только при Ranked = true; все операции за O(log n)
+  // Пара с номером k в порядке обхода (с нуля); end(), если k >= size()
+  iterator nth(size_type k);
+  const_iterator nth(size_type k) const;
+  // Число пар с ключом меньше key, то есть номер lower_bound(key)
+  size_type rank(const Key& key) const;
+  // Число пар с ключом из [lo, hi)
+  size_type count_range(const Key& lo, const Key& hi) const;
+  // Номер позиции pos в порядке обхода; index(end()) == size()
+  size_type index(const_iterator pos) const;
+  // Число шагов от first до last, как std::distance
+  std::ptrdiff_t distance(const_iterator first, const_iterator last) const;
 
   // Part3
   template <typename... Args>
@@ -112,7 +286,34 @@ class map {
 
  private:
   // Приватные функции для балансировки и работы с деревом
-  iterator find(const Key& key) const;
+  // Вставка готовой пары: узел выделяется, только если ключа еще нет
+  template <typename V>
+  std::pair<iterator, bool> insert_unique(V&& value);
+  template <typename V>
+  iterator insert_unique(const_iterator hint, V&& value);
+  // Ищет key и при отсутствии создает узел с mapped_type(args...)
+  template <typename K, typename... Args>
+  std::pair<Node*, bool> emplace_key(K&& key, Args&&... args);
+  template <typename K, typename M>
+  std::pair<iterator, bool> assign_key(K&& key, M&& obj);
+  // Привязывает новый узел в найденную позицию и балансирует дерево
+  Node* link_node(const insert_pos& pos, Node* node);
+  // Выделение и освобождение узлов через аллокатор
+  template <typename... Args>
+  Node* create_node(Args&&... args);
+  void destroy_node(Node* node);
+  // Строит дерево пустого контейнера из [first, last) через tree_builder
+  template <typename InputIt>
+  void build(InputIt first, InputIt last);
+  // Подвешивает список узлов как сбалансированное дерево вместо текущего
+  void adopt(const chain& nodes);
+  map combine(const map& other, tree_set_op op) const;
+  // Можно ли забирать узлы other: их память выделена равным аллокатором
+  bool shares_memory(const map& other) const;
+  // Освобождает все узлы дерева, не трогая root_ и size_
+  void release_nodes();
+  // Обмен деревьями без учета аллокаторов
+  void swap_nodes(map& other) noexcept;
   void balance_after_insert(Node* node);
   void balance_after_erase(Node* node, Node* parent);
   void rotate_left(Node* node);
@@ -121,6 +322,19 @@ class map {
   Node* find_max(Node* node) const;
 };
 
+namespace pmr {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using map =
+    s21::map<Key, T, Compare,
+             std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+
+namespace ranked {
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+using map = s21::map<Key, T, Compare, Allocator, true>;
+}  // namespace ranked
+
 }  // namespace s21
 
 #include "s21_map.inc"
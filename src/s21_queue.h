@@ -1,34 +1,61 @@
 #ifndef SRC_S21_QUEUE_H
 #define SRC_S21_QUEUE_H
 
+#include <cstddef>
+#include <cstring>  // For std::memcpy
+#include <initializer_list>
+#include <memory>  // For std::allocator_traits
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>  // For std::forward
+
+#include "s21_allocator.h"
+#include "s21_storage.h"
+
 namespace s21 {
 
-template <typename T>
+// Способ хранения задается третьим параметром шаблона: node_storage или
+// ring_storage (см. s21_storage.h)
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Storage = node_storage>
+class queue;
 
-class queue {
+// Узлы очереди выделяются через Allocator
+template <typename T, typename Allocator>
+class queue<T, Allocator, node_storage> {
  public:
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
 
  private:
   struct Node {
     T data;
     Node* next;
-    Node(const T& value) : data(value), next(nullptr) {}
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : data(std::forward<Args>(args)...), next(nullptr) {}
   };
 
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
   Node* front_;
   Node* back_;
   size_type size_;
 
  public:
   queue();  // Конструктор по умолчанию
+  explicit queue(const Allocator& alloc);
   queue(std::initializer_list<value_type> const&
             items);           // initializer list constructor
   queue(const queue& other);  // Конструктор копирования
-  queue(queue&& other);       // Конструктор перемещения
+  queue(queue&& other) noexcept;  // Конструктор перемещения
   ~queue();                   // Деструктор
 
   queue& operator=(const queue& other);  // Оператор присваивания копированием
@@ -41,13 +68,101 @@ class queue {
   size_t size() const;  // Получение размера
 
   void push(const T& value);  // Добавление элемента в конец
+  void push(T&& value);
+  // Создание элемента в конце прямо из args
+  template <typename... Args>
+  reference emplace(Args&&... args);
   void pop();  // Удаление элемента из начала
   void swap(queue& other);  // Обмен содержимым с другим очередью
 
+  allocator_type get_allocator() const;
+
   // Part 3 (Bonus)
   template <typename... Args>
   void insert_many_back(Args&&... args);
+
+ private:
+  void swap_nodes(queue& other) noexcept;
+  void copy_nodes(const queue& other);
+  void release_nodes() noexcept;
+  template <typename... Args>
+  Node* create_node(Args&&... args);
+  void destroy_node(Node* node);
+};
+
+// Очередь на кольцевом буфере: элементы лежат подряд, индекс ячейки
+// берется по маске capacity - 1
+template <typename T, typename Allocator, std::size_t FixedCapacity>
+class queue<T, Allocator, ring_storage<FixedCapacity>>
+    : private inline_slots<T, FixedCapacity> {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  queue();
+  explicit queue(const Allocator& alloc);
+  queue(std::initializer_list<value_type> const& items);
+  queue(const queue& other);
+  queue(const queue& other, const Allocator& alloc);
+  // Встроенные ячейки не передать, и их элементы перемещаются по одному
+  queue(queue&& other) noexcept(FixedCapacity == 0 ||
+                                std::is_nothrow_move_constructible_v<T>);
+  ~queue();
+
+  queue& operator=(const queue& other);
+  queue& operator=(queue&& other);
+
+  const T& front() const;
+  const T& back() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  void push(const T& value);
+  void push(T&& value);
+  template <typename... Args>
+  reference emplace(Args&&... args);
+  void pop();
+  void swap(queue& other);
+
+  allocator_type get_allocator() const;
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static constexpr bool kFixed = FixedCapacity != 0;
+  static constexpr size_type kMinCapacity = 8;
+
+  static constexpr bool relocates_bitwise() noexcept;
+  T* slot(size_type index) const noexcept;
+  // Емкость не меньше n; растущее кольцо переносит элементы в новый буфер
+  void reserve_slots(size_type n);
+  // Переносит элементы по порядку в начало нового буфера dest
+  void relocate_to(T* dest);
+  void destroy_elements() noexcept;
+  void release_storage() noexcept;
+  // Перемещает элементы from в конец очереди, from становится пустой
+  void take_elements(queue& from);
+  void swap_storage(queue& other);
+
+  Allocator alloc_;
+  T* data_;
+  size_type capacity_;
+  size_type head_;  // Ячейка первого элемента
+  size_type size_;
 };
+
+namespace pmr {
+template <typename T, typename Storage = node_storage>
+using queue = s21::queue<T, std::pmr::polymorphic_allocator<T>, Storage>;
+}  // namespace pmr
 }  // namespace s21
 
 #include "s21_queue.inc"
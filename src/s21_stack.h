@@ -1,33 +1,58 @@
 #ifndef SRC_S21_STACK_H_
 #define SRC_S21_STACK_H_
 
+#include <cstddef>
+#include <cstring>  // For std::memcpy
+#include <initializer_list>
 #include <iostream>
+#include <memory>  // For std::allocator_traits
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>  // For std::forward
+
+#include "s21_allocator.h"
+#include "s21_storage.h"
 
 namespace s21 {
 
-template <typename T>
+// Способ хранения задается третьим параметром шаблона: node_storage или
+// array_storage (см. s21_storage.h)
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Storage = node_storage>
+class stack;
 
-class stack {
+// Узлы стека выделяются через Allocator
+template <typename T, typename Allocator>
+class stack<T, Allocator, node_storage> {
  public:
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
 
  private:
   struct Node {
     T data;
     Node* prev;
-    Node(const T& value)
-        : data(value), prev(nullptr) {}  // parametriezed constructor
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : data(std::forward<Args>(args)...), prev(nullptr) {}
   };
 
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
   Node* top_;
   size_type size_;
 
  public:
   // Stack Constructors
   stack();  // default constructor
+  explicit stack(const Allocator& alloc);  // empty stack with given allocator
   stack(std::initializer_list<value_type> const&
             items);               // initializer list constructor
   stack(const stack& other);      // copy constructor
@@ -47,13 +72,100 @@ class stack {
 
   // Stack Modifiers
   void push(const T& value);
+  void push(T&& value);
+  template <typename... Args>
+  reference emplace(Args&&... args);  // construct new top in place
   void pop();
   void swap(stack& other);
 
+  allocator_type get_allocator() const;
+
   // Part 3 (Bonus)
   template <class... Args>
   void insert_many_back(Args&&... args);
+
+ private:
+  void swap_nodes(stack& other) noexcept;
+  void copy_nodes(const stack& other);
+  void release_nodes() noexcept;
+  template <typename... Args>
+  Node* create_node(Args&&... args);
+  void destroy_node(Node* node);
+};
+
+// Стек на непрерывном массиве: первые InlineCapacity элементов лежат в
+// самом стеке, дальше массив выделяется через Allocator и растет вдвое
+template <typename T, typename Allocator, std::size_t InlineCapacity>
+class stack<T, Allocator, array_storage<InlineCapacity>>
+    : private inline_slots<T, InlineCapacity> {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  stack();
+  explicit stack(const Allocator& alloc);
+  stack(std::initializer_list<value_type> const& items);
+  stack(const stack& other);
+  stack(const stack& other, const Allocator& alloc);
+  // Встроенные ячейки не передать, и их элементы перемещаются по одному
+  stack(stack&& other) noexcept(InlineCapacity == 0 ||
+                                std::is_nothrow_move_constructible_v<T>);
+  ~stack();
+
+  stack& operator=(const stack& other);
+  stack& operator=(stack&& other);
+
+  const T& top();
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  void push(const T& value);
+  void push(T&& value);
+  template <typename... Args>
+  reference emplace(Args&&... args);
+  void pop();
+  void swap(stack& other);
+
+  allocator_type get_allocator() const;
+
+  template <class... Args>
+  void insert_many_back(Args&&... args);
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static constexpr size_type kMinCapacity = 8;
+
+  static constexpr bool relocates_bitwise() noexcept;
+  bool is_inline() const noexcept;
+  size_type grown_capacity() const;
+  // Емкость не меньше n
+  void reserve_slots(size_type n);
+  // Переносит элементы в начало нового массива dest
+  void relocate_to(T* dest);
+  // Копирует элементы other в пустой стек
+  void copy_elements(const stack& other);
+  void destroy_elements() noexcept;
+  void release_storage() noexcept;
+  // Перемещает элементы from наверх стека, from становится пустым
+  void take_elements(stack& from);
+  void swap_storage(stack& other);
+
+  Allocator alloc_;
+  T* data_;
+  size_type size_;
+  size_type capacity_;
 };
+
+namespace pmr {
+template <typename T, typename Storage = node_storage>
+using stack = s21::stack<T, std::pmr::polymorphic_allocator<T>, Storage>;
+}  // namespace pmr
 }  // namespace s21
 
 #include "s21_stack.inc"  // Methods' realization
@@ -0,0 +1,48 @@
+#ifndef S21_STORAGE_H_
+#define S21_STORAGE_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// Размер строки кэша: по нему выравниваются узлы B-деревьев и данные,
+// которые меняют разные потоки
+inline constexpr std::size_t cache_line_size = 64;
+
+// Способы хранения элементов для адаптеров (queue, stack) задаются
+// последним параметром шаблона; открытый интерфейс от них не зависит.
+
+// Узел на каждый элемент: адреса элементов не меняются, но каждая вставка
+// выделяет память, а обход идет по указателям
+struct node_storage {};
+
+// Кольцевой буфер из 2^k ячеек. При FixedCapacity == 0 буфер выделяется
+// через Allocator и растет вдвое. Иначе FixedCapacity ячеек (степень двойки)
+// лежат в самой очереди: память не выделяется, а push в полную очередь
+// бросает std::length_error
+template <std::size_t FixedCapacity = 0>
+struct ring_storage {
+  static_assert((FixedCapacity & (FixedCapacity - 1)) == 0,
+                "ring capacity must be a power of two");
+};
+
+// Непрерывный массив, растущий вдвое. Первые InlineCapacity элементов
+// лежат в самом контейнере, память выделяется только при переполнении
+template <std::size_t InlineCapacity = 16>
+struct array_storage {};
+
+// Ячейки под Capacity элементов внутри объекта-контейнера
+template <typename T, std::size_t Capacity>
+struct inline_slots {
+  T* slots() noexcept { return reinterpret_cast<T*>(bytes_); }
+  alignas(T) unsigned char bytes_[Capacity * sizeof(T)];
+};
+
+template <typename T>
+struct inline_slots<T, 0> {
+  T* slots() noexcept { return nullptr; }
+};
+
+}  // namespace s21
+
+#endif  // S21_STORAGE_H_
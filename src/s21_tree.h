@@ -0,0 +1,272 @@
+#ifndef S21_TREE_H_
+#define S21_TREE_H_
+
+#include <algorithm>  // For std::stable_sort
+#include <cstddef>
+#include <functional>  // For std::less
+#include <memory>      // For std::allocator
+#include <type_traits>
+#include <utility>  // For std::pair
+
+#include "s21_stack.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Стек для обхода дерева в глубину. В нем не больше узлов, чем высота
+// дерева плюс один (не больше 2 * log2(n + 1) + 1), поэтому 64 встроенных
+// ячеек хватает без выделения памяти для деревьев до 2^31 узлов
+template <typename Node>
+using tree_walk_stack = stack<Node*, std::allocator<Node*>, array_storage<64>>;
+
+// Извлечение ключа из значения узла: для set/multiset ключом является само
+// значение, для map - первый элемент пары
+struct tree_key_identity {
+  template <typename V>
+  const V& operator()(const V& value) const {
+    return value;
+  }
+};
+
+struct tree_key_first {
+  template <typename V>
+  const typename V::first_type& operator()(const V& value) const {
+    return value.first;
+  }
+};
+
+// Компаратор дерева. Пустой компаратор (std::less и т. п.) хранится как
+// пустой базовый класс контейнера и не увеличивает его размер
+template <typename Compare, bool Empty = std::is_empty<Compare>::value &&
+                                         !std::is_final<Compare>::value>
+class tree_compare : private Compare {
+ public:
+  tree_compare() : Compare() {}
+  explicit tree_compare(const Compare& comp) : Compare(comp) {}
+
+ protected:
+  const Compare& comp() const noexcept { return *this; }
+};
+
+template <typename Compare>
+class tree_compare<Compare, false> {
+ public:
+  tree_compare() : comp_() {}
+  explicit tree_compare(const Compare& comp) : comp_(comp) {}
+
+ protected:
+  const Compare& comp() const noexcept { return comp_; }
+
+ private:
+  Compare comp_;
+};
+
+// Разнородный поиск (по string_view в дереве строк и т. п.) доступен, если
+// компаратор объявляет is_transparent, как std::less<>
+template <typename Compare>
+using tree_transparent = typename Compare::is_transparent;
+
+// Позиция для привязки нового узла, найденная за один спуск
+template <typename Node>
+struct tree_insert_pos {
+  Node* parent;    // Родитель нового узла, nullptr для пустого дерева
+  bool left;       // Привязывать ли новый узел левым ребенком
+  Node* existing;  // Узел с эквивалентным ключом, если вставка невозможна
+};
+
+// Общий слой поиска для красно-черных деревьев set, map и multiset.
+// Node - узел дерева с полями value, left, right, parent.
+// Все функции спускаются от корня по одной ветке: O(log n), без выделения
+// памяти. Ключи сравниваются только через comp, как в алгоритмах std:
+// ключи a и b эквивалентны, если !comp(a, b) && !comp(b, a)
+template <typename Node, typename KeyOf, typename Compare>
+class tree_lookup {
+ public:
+  // Первый узел, ключ которого не меньше key (nullptr, если такого нет)
+  template <typename K>
+  static Node* lower_bound(Node* root, const K& key, const Compare& comp);
+  // Первый узел, ключ которого больше key (nullptr, если такого нет)
+  template <typename K>
+  static Node* upper_bound(Node* root, const K& key, const Compare& comp);
+  // Первый узел с ключом, эквивалентным key (nullptr, если такого нет)
+  template <typename K>
+  static Node* find(Node* root, const K& key, const Compare& comp);
+  template <typename K>
+  static std::pair<Node*, Node*> equal_range(Node* root, const K& key,
+                                             const Compare& comp);
+
+  // Позиция вставки уникального ключа либо уже существующий узел
+  template <typename K>
+  static tree_insert_pos<Node> unique_pos(Node* root, const K& key,
+                                          const Compare& comp);
+  // Позиция вставки с дубликатами: после всех эквивалентных ключей
+  template <typename K>
+  static tree_insert_pos<Node> equal_pos(Node* root, const K& key,
+                                         const Compare& comp);
+  // То же с подсказкой hint - узлом, перед которым ожидается вставка.
+  // nullptr (позиция end()) означает вставку в конец. Если подсказка верна,
+  // позиция находится за амортизированное O(1), иначе выполняется обычный
+  // спуск от корня
+  template <typename K>
+  static tree_insert_pos<Node> unique_hint_pos(Node* root, Node* rightmost,
+                                               Node* hint, const K& key,
+                                               const Compare& comp);
+  template <typename K>
+  static tree_insert_pos<Node> equal_hint_pos(Node* root, Node* rightmost,
+                                              Node* hint, const K& key,
+                                              const Compare& comp);
+
+  // Соседние узлы в порядке обхода (nullptr, если соседа нет)
+  static Node* next(Node* node);
+  static Node* prev(Node* node);
+
+  // Обходит дерево снизу вверх и передает каждый узел в destroy после его
+  // детей. Использует указатели на родителя вместо стека: O(n), без
+  // выделения памяти. Связи дерева при обходе разрушаются
+  template <typename F>
+  static void dismantle(Node* root, F destroy);
+
+ private:
+  // Позиции непосредственно перед и после узла node
+  static tree_insert_pos<Node> before(Node* node);
+  static tree_insert_pos<Node> after(Node* node);
+};
+
+// Размер поддерева для деревьев с порядковой статистикой. Узел наследует
+// tree_rank<Ranked>; tree_rank<false> пуст и места в узле не занимает
+template <bool Ranked>
+struct tree_rank {};
+
+template <>
+struct tree_rank<true> {
+  std::size_t count = 1;  // Число узлов поддерева вместе с самим узлом
+};
+
+// Порядковая статистика: k-й узел, ранг ключа и номер узла за O(log n) по
+// размерам поддеревьев. Контейнер вызывает функции обновления при каждом
+// изменении формы дерева; для узлов без tree_rank<true> они ничего не делают
+template <typename Node, typename KeyOf, typename Compare>
+class tree_order {
+ public:
+  static constexpr bool enabled =
+      std::is_base_of<tree_rank<true>, Node>::value;
+
+  // Число узлов поддерева; 0 для nullptr и для узлов без размеров
+  static std::size_t count(const Node* node);
+  // Пересчитывает размер node по его детям, например после поворота
+  static void update(Node* node);
+  static void assign(Node* node, std::size_t count);
+  // В поддерево node добавлен (grow) или из него удален (shrink) один узел:
+  // размеры node и всех его предков меняются на единицу
+  static void grow(Node* node);
+  static void shrink(Node* node);
+
+  // Узел с номером k в порядке обхода (nullptr, если k >= count(root))
+  static Node* nth(Node* root, std::size_t k);
+  // Число узлов с ключом меньше key, то есть номер lower_bound
+  template <typename K>
+  static std::size_t rank(Node* root, const K& key, const Compare& comp);
+  // Число узлов с ключом не больше key, то есть номер upper_bound
+  template <typename K>
+  static std::size_t upper_rank(Node* root, const K& key,
+                                const Compare& comp);
+  // Номер узла в порядке обхода: подъем к корню, O(log n)
+  static std::size_t index(const Node* node);
+};
+
+// Узлы, связанные через right в список по возрастанию ключа. Через такой
+// список узлы переходят из диапазона или из другого дерева в tree_builder
+template <typename Node>
+struct tree_chain {
+  Node* head;
+  Node* tail;
+  std::size_t size;
+};
+
+// Операции над множествами: объединение, пересечение, разность и
+// симметрическая разность
+enum class tree_set_op { unite, intersect, subtract, symmetric };
+
+// Построение красно-черного дерева целиком, а не вставкой по одному узлу.
+// Узлы сначала выстраиваются в список по возрастанию ключа, затем link
+// подвешивает список как идеально сбалансированное дерево за O(n): без
+// поиска, поворотов и перекрашиваний. Так строятся set, map и multiset из
+// диапазона и результат merge; копии деревьев делает clone
+template <typename Node, typename KeyOf, typename Compare>
+class tree_builder {
+ public:
+  using chain = tree_chain<Node>;
+
+  // Создает узлы из [first, last) вызовом create(*first) и выстраивает их по
+  // возрастанию ключа. Упорядоченный вход только проверяется за O(n),
+  // остальной сортируется устойчиво за O(n log n). При Unique из
+  // эквивалентных ключей остается первый, лишние узлы уходят в destroy.
+  // При исключении все созданные узлы освобождаются
+  template <bool Unique, typename InputIt, typename Create, typename Destroy>
+  static chain collect(InputIt first, InputIt last, Create create,
+                       Destroy destroy, const Compare& comp);
+  // Разбирает дерево в список в порядке обхода: O(n), без выделения памяти
+  static chain flatten(Node* root);
+  // Сливает два списка в один; при равных ключах узлы first идут раньше
+  static chain merge(chain first, chain second, const Compare& comp);
+  // Подвешивает список как дерево и возвращает корень (nullptr для пустого
+  // списка). Поддеревья делятся пополам, поэтому заполнены все уровни, кроме
+  // нижнего; узлы неполного нижнего уровня красные, остальные черные
+  template <typename Color>
+  static Node* link(const chain& nodes, Color red, Color black);
+
+  // Копирует дерево узел в узел за один обход: та же форма и те же цвета,
+  // без поиска и балансировки. create(value) создает несвязанный узел.
+  // Узлы копии создаются в прямом порядке обхода, поэтому каждое поддерево
+  // занимает в пуле соседние блоки. При исключении копия освобождается
+  template <typename Create, typename Destroy>
+  static Node* clone(const Node* root, Create create, Destroy destroy);
+
+  // Сливает два списка с уникальными ключами. Узлы second с ключами,
+  // которые уже есть в first, переходят в rejected
+  static chain merge_unique(chain first, chain second, chain& rejected,
+                            const Compare& comp);
+  // Обходит оба дерева по возрастанию ключа и передает в emit узлы
+  // результата op, как std::set_union и родственные алгоритмы: при равных
+  // ключах берется узел lhs, повторы в multiset учитываются поштучно.
+  // Участки, которые не попадают в результат, перескакиваются: после
+  // нескольких шагов по соседям выполняется спуск от корня, поэтому
+  // пересечение с деревом из m << n узлов стоит O(m log n), а не O(n + m)
+  template <typename Emit>
+  static void combine(Node* lhs, Node* rhs, tree_set_op op, Emit emit,
+                      const Compare& comp);
+
+  // Выгоднее ли привязать count узлов к дереву из size узлов по одному за
+  // O(count log size), чем пересобрать дерево целиком за O(size + count)
+  static bool prefer_insert(std::size_t count, std::size_t size);
+
+  // Добавляет узел в конец списка
+  static void append(chain& nodes, Node* node);
+  // Передает в destroy все узлы списка
+  template <typename Destroy>
+  static void release(Node* head, Destroy destroy);
+
+ private:
+  template <bool Unique, typename Destroy>
+  static void sort(chain& nodes, Destroy destroy, const Compare& comp);
+  // Собирает список заново в порядке массива order, извлекая узлы через
+  // node_of
+  template <bool Unique, typename Entry, typename NodeOf, typename Destroy>
+  static void relink(chain& nodes, const Entry* order, std::size_t size,
+                     NodeOf node_of, Destroy destroy, const Compare& comp);
+  // Строит поддерево из n узлов, начиная с cursor, и сдвигает cursor за них
+  template <typename Color>
+  static Node* link_subtree(Node*& cursor, std::size_t n, std::size_t depth,
+                            std::size_t red_depth, Color red, Color black);
+  static bool less(const Node* lhs, const Node* rhs, const Compare& comp);
+  // Первый узел поддерева root с ключом не меньше, чем у bound. Поиск
+  // начинается с node - первого еще не пройденного узла
+  static Node* skip(Node* root, Node* node, const Node* bound,
+                    const Compare& comp);
+  static Node* leftmost(Node* root);
+};
+
+}  // namespace s21
+
+#include "s21_tree.inc"
+#endif  // S21_TREE_H_
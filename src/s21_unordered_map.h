@@ -0,0 +1,68 @@
+#ifndef S21_UNORDERED_MAP_H_
+#define S21_UNORDERED_MAP_H_
+
+#include <functional>  // For std::hash, std::equal_to
+#include <memory>      // For std::allocator
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>    // For std::forward_as_tuple
+#include <utility>  // For std::piecewise_construct
+
+#include "s21_hash_table.h"
+#include "s21_tree.h"  // For tree_key_first
+
+namespace s21 {
+
+// Неупорядоченный словарь на хеш-таблице с открытой адресацией и тем же
+// интерфейсом доступа по ключу, что у s21::map. Пары лежат прямо в ячейках
+// таблицы; при перестройке ключ перемещается, а не копируется
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map
+    : public hash_table<hash_params<Key, std::pair<const Key, T>,
+                                    tree_key_first, Hash, KeyEqual,
+                                    Allocator>> {
+  using base = hash_table<hash_params<Key, std::pair<const Key, T>,
+                                      tree_key_first, Hash, KeyEqual,
+                                      Allocator>>;
+
+ public:
+  using mapped_type = T;
+  using typename base::iterator;
+  using typename base::value_type;
+
+  using base::base;
+
+  T& at(const Key& key);
+  T& operator[](const Key& key);
+  T& operator[](Key&& key);
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, T&& obj);
+  std::pair<iterator, bool> insert_or_assign(Key&& key, T&& obj);
+  // Пара создается, только если ключа еще нет
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+
+ private:
+  template <typename K, typename M>
+  std::pair<iterator, bool> assign_key(K&& key, M&& obj);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(K&& key, Args&&... args);
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using unordered_map = s21::unordered_map<
+    Key, T, Hash, KeyEqual,
+    std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#include "s21_unordered_map.inc"
+#endif  // S21_UNORDERED_MAP_H_
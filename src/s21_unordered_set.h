@@ -0,0 +1,31 @@
+#ifndef S21_UNORDERED_SET_H_
+#define S21_UNORDERED_SET_H_
+
+#include <functional>  // For std::hash, std::equal_to
+#include <memory>      // For std::allocator
+#include <memory_resource>
+
+#include "s21_hash_table.h"
+#include "s21_tree.h"  // For tree_key_identity
+
+namespace s21 {
+
+// Неупорядоченное множество на хеш-таблице с открытой адресацией. Поиск,
+// вставка и удаление - O(1) в среднем. Вставка может перестроить таблицу и
+// сделать итераторы недействительными; удаление их не трогает
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>>
+using unordered_set = hash_table<
+    hash_params<Key, Key, tree_key_identity, Hash, KeyEqual, Allocator>>;
+
+namespace pmr {
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using unordered_set = s21::unordered_set<Key, Hash, KeyEqual,
+                                         std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_SET_H_
@@ -1,16 +1,52 @@
 #ifndef SRC_S21_VECTOR_H
 #define SRC_S21_VECTOR_H
 
+#include <algorithm>  // For std::move_backward, std::rotate
+#include <cstring>    // For std::memcpy, std::memmove
+#include <iterator>   // For std::move_iterator
+#include <memory>     // For std::allocator_traits
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_allocator.h"
+
 namespace s21 {
 
-template <typename T>
+// Политика емкости вектора. При нехватке места емкость умножается на
+// GrowNum / GrowDen. Если после удаления заполнено не больше 1 / ShrinkDen
+// буфера, емкость делится на тот же множитель; ShrinkDen == 0 - никогда не
+// сжимать. Разрыв между порогами (гистерезис) не дает емкости скакать туда
+// и обратно, поэтому и push_back, и pop_back амортизированно O(1)
+template <std::size_t GrowNum = 2, std::size_t GrowDen = 1,
+          std::size_t ShrinkDen = 0>
+struct growth_policy {
+  static_assert(GrowDen > 0 && GrowNum > GrowDen,
+                "growth factor must be greater than 1");
+  static_assert(ShrinkDen == 0 || ShrinkDen * GrowDen > GrowNum,
+                "shrink threshold must leave room after shrinking");
+
+  // Новая емкость не меньше required
+  static std::size_t grow(std::size_t capacity, std::size_t required) noexcept;
+  // Новая емкость для size элементов; capacity, если сжимать не нужно
+  static std::size_t shrink(std::size_t capacity, std::size_t size) noexcept;
+};
 
+// Рост вдвое, буфер не сжимается (как у std::vector)
+using never_shrink_policy = growth_policy<2, 1, 0>;
+// Рост вдвое, сжатие вдвое при заполнении не больше четверти
+using shrinking_policy = growth_policy<2, 1, 4>;
+
+// Память под элементы выделяется через Allocator, емкость меняется по Policy
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Policy = never_shrink_policy>
 class vector {
  public:
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   // Вложенный класс итератора
   class iterator {
@@ -44,15 +80,20 @@ class vector {
 
   // Constructors
   vector();
+  explicit vector(const Allocator& alloc);
   vector(size_t n);
   vector(std::initializer_list<T> init);
   vector(const vector& v);
-  vector(vector&& v);
+  vector(const vector& v, const Allocator& alloc);
+  vector(vector&& v) noexcept;
   ~vector();
 
   // Assignment operators
   vector& operator=(const vector& v);
-  vector& operator=(vector&& v) noexcept;
+  vector& operator=(vector&& v) noexcept(
+      allocator_always_steals<Allocator>::value);
+
+  allocator_type get_allocator() const;
 
   // Element access
   T& at(size_t pos);
@@ -77,8 +118,16 @@ class vector {
   // Modifiers
   void clear();
   iterator insert(iterator pos, const T& value);
+  iterator insert(iterator pos, T&& value);
+  // Создает элемент из args перед pos. Как и в insert, args могут ссылаться
+  // на элементы этого же вектора
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args);
   void erase(iterator pos);
   void push_back(const T& value);
+  void push_back(T&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
   void pop_back();
   void swap(vector& other);
 
@@ -89,12 +138,60 @@ class vector {
   void insert_many_back(Args&&... args);
 
  private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  // Буфер выделяется без создания элементов: живы только первые size_
+  // ячеек, остальная емкость - сырая память
+  T* allocate_storage(size_type n);
+  void deallocate_storage(T* data, size_type n) noexcept;
+  void destroy_elements(T* first, T* last) noexcept;
+  // Создает копии [first, last) в сырой памяти dest. При исключении уже
+  // созданные элементы разрушаются
+  template <typename InputIt>
+  T* construct_range(InputIt first, InputIt last, T* dest);
+  template <typename... Args>
+  void construct_args(T* dest, Args&&... args);
+  // Элементы переносятся побайтно (memcpy/memmove), если тип тривиально
+  // переносим, а аллокатор не переопределяет construct/destroy
+  static constexpr bool relocates_bitwise() noexcept;
+  // Переносит [first, last) в сырую память dest, после чего исходные ячейки
+  // становятся сырой памятью. Без побайтного переноса элементы перемещаются,
+  // если это не бросает исключений, иначе копируются (std::move_if_noexcept)
+  void relocate(T* first, T* last, T* dest);
+  // Ставит последние Count элементов на позицию index, сдвигая хвост вправо
+  template <std::size_t Count>
+  void rotate_back(size_type index);
+  // Освобождает старый буфер (элементы уже перенесены) и переходит на новый
+  void adopt_storage(T* new_data, size_type new_cap) noexcept;
+  // Сжимает буфер, если Policy считает его слишком пустым
+  void shrink_if_sparse() noexcept;
+  void reallocate(size_type new_cap);
+  // Создает count элементов в конце вектора вызовом build(dest), где dest -
+  // сырая память под них. При нехватке места новые элементы создаются
+  // раньше переноса старых, поэтому аргументы build могут ссылаться на
+  // элементы этого же вектора
+  template <typename Build>
+  void build_back(size_type count, Build build);
+  // Создает по элементу из каждого args в конце вектора
+  template <typename... Args>
+  void append(Args&&... args);
+  // Освобождает буфер и оставляет вектор пустым
+  void release_storage() noexcept;
+  // Обмен буферами без учета аллокаторов
+  void swap_storage(vector& other) noexcept;
+
+  Allocator alloc_;
   T* data_;          // Pointer to dynamically allocated array
   size_t size_;      // Number of elements in the vector
   size_t capacity_;  // Capacity of the vector
   size_t index_;
 };
 
+namespace pmr {
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #include "s21_vector.inc"
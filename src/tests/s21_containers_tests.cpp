@@ -1,11 +1,47 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
 #include <queue>
+#include <random>
+#include <set>
 #include <stack>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "../s21_containers.h"
 
+// Ресурс памяти, считающий занятые байты: по нему видно, что контейнер
+// выделяет память через свой аллокатор и полностью ее возвращает
+class counting_resource : public std::pmr::memory_resource {
+ public:
+  std::size_t in_use = 0;
+  std::size_t null_frees = 0;  // Освобождения nullptr: их быть не должно
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t align) override {
+    in_use += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+  void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+    if (p == nullptr) ++null_frees;
+    in_use -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
 // queue_tests
 // Constructors
 
@@ -371,6 +407,227 @@ TEST(QueueTest, InsertManyBack_LargeData) {
   EXPECT_EQ(q.back(), "large_string3");
 }
 
+TEST(QueueTest, Pmr_Resource) {
+  counting_resource resource;
+  {
+    s21::pmr::queue<std::string> q(&resource);
+    for (int i = 0; i < 100; ++i) q.push(std::to_string(i));
+    ASSERT_GT(resource.in_use, 0U);
+    s21::pmr::queue<std::string> other(&resource);
+    other = q;  // Аллокатор не меняется, память берется из того же ресурса
+    q.pop();
+    ASSERT_EQ(other.front(), "0");
+    ASSERT_EQ(q.front(), "1");
+    ASSERT_TRUE(other.get_allocator().resource() == &resource);
+  }
+  ASSERT_EQ(resource.in_use, 0U);
+}
+
+TEST(QueueTest, Emplace_Move_Only) {
+  s21::queue<std::unique_ptr<int>> q;
+  q.push(std::make_unique<int>(1));
+  int& value = *q.emplace(new int(2));
+  ASSERT_EQ(value, 2);
+  q.insert_many_back(std::make_unique<int>(3));
+  ASSERT_EQ(q.size(), 3U);
+  ASSERT_EQ(*q.front(), 1);
+  ASSERT_EQ(*q.back(), 3);
+}
+
+TEST(QueueTest, Ring_Wraparound) {
+  s21::queue<int, std::allocator<int>, s21::ring_storage<>> q;
+  std::queue<int> q_;
+  // Голова уходит вперед, и при росте кольцо переносится с разрывом
+  for (int i = 0; i < 1000; ++i) {
+    q.push(i);
+    q_.push(i);
+    if (i % 3 == 1) {
+      q.pop();
+      q_.pop();
+    }
+    ASSERT_EQ(q.front(), q_.front());
+    ASSERT_EQ(q.back(), q_.back());
+  }
+  ASSERT_EQ(q.size(), q_.size());
+  ASSERT_EQ(q.capacity() & (q.capacity() - 1), 0U);
+  auto copy = q;
+  while (!q_.empty()) {
+    ASSERT_EQ(copy.front(), q_.front());
+    copy.pop();
+    q_.pop();
+  }
+  ASSERT_TRUE(copy.empty());
+}
+
+TEST(QueueTest, Ring_Push_Own_Front) {
+  s21::queue<std::string, std::allocator<std::string>, s21::ring_storage<>> q;
+  q.push("first");
+  while (q.size() < q.capacity()) q.push("x");
+  q.push(q.front());  // Рост буфера: аргумент ссылается на старый буфер
+  ASSERT_EQ(q.back(), "first");
+  ASSERT_EQ(q.front(), "first");
+}
+
+TEST(QueueTest, Ring_Move_Only) {
+  using ring_queue = s21::queue<std::unique_ptr<int>,
+                                std::allocator<std::unique_ptr<int>>,
+                                s21::ring_storage<>>;
+  ring_queue q;
+  for (int i = 0; i < 20; ++i) q.emplace(new int(i));
+  ring_queue moved(std::move(q));
+  ASSERT_TRUE(q.empty());
+  ring_queue other;
+  other.push(std::make_unique<int>(-1));
+  other.swap(moved);
+  ASSERT_EQ(*other.front(), 0);
+  ASSERT_EQ(*moved.front(), -1);
+  moved = std::move(other);
+  ASSERT_EQ(moved.size(), 20U);
+  ASSERT_EQ(*moved.back(), 19);
+}
+
+TEST(QueueTest, Ring_Empty_Storage) {
+  counting_resource resource;
+  using ring_queue = s21::pmr::queue<int, s21::ring_storage<>>;
+  {
+    ring_queue empty(&resource);
+    ring_queue grown(&resource);
+    grown.push(1);  // Рост с пустого буфера
+    ring_queue copy(grown, &resource);  // Резерв под копию в пустом буфере
+    ring_queue moved(std::move(empty));
+    ring_queue target(&resource);
+    target = std::move(moved);
+  }
+  ASSERT_EQ(resource.null_frees, 0U);
+  ASSERT_EQ(resource.in_use, 0U);
+}
+
+TEST(QueueTest, Ring_Fixed_Capacity) {
+  counting_resource resource;
+  using fixed_queue = s21::pmr::queue<std::string, s21::ring_storage<4>>;
+  fixed_queue q(&resource);
+  q.insert_many_back("a", "b", "c");
+  q.pop();
+  q.push("d");
+  q.push("e");  // Занимает ячейку, освобожденную pop
+  ASSERT_THROW(q.push("f"), std::length_error);
+  ASSERT_EQ(q.size(), 4U);
+  fixed_queue other(&resource);
+  other.push("z");
+  q.swap(other);
+  ASSERT_EQ(q.front(), "z");
+  ASSERT_EQ(other.front(), "b");
+  ASSERT_EQ(other.back(), "e");
+  fixed_queue copy(other);
+  copy.pop();
+  ASSERT_EQ(copy.front(), "c");
+  ASSERT_EQ(resource.in_use, 0U);  // Элементы лежат в самой очереди
+}
+
+// Очереди для обмена между потоками
+
+TEST(ConcurrentQueueTest, Spsc_Bounded) {
+  s21::spsc_queue<std::string> q(3);  // Округляется до 4
+  ASSERT_EQ(q.capacity(), 4U);
+  std::vector<std::string> items = {"a", "b", "c", "d", "e"};
+  ASSERT_EQ(q.try_push_many(items.begin(), items.end()), 4U);
+  ASSERT_FALSE(q.try_push("f"));
+  std::string value;
+  ASSERT_TRUE(q.try_pop(value));
+  ASSERT_EQ(value, "a");
+  ASSERT_TRUE(q.try_emplace(2, 'z'));
+  std::vector<std::string> out;
+  ASSERT_EQ(q.try_pop_many(std::back_inserter(out), 10), 4U);
+  std::vector<std::string> expected = {"b", "c", "d", "zz"};
+  ASSERT_EQ(out, expected);
+  ASSERT_FALSE(q.try_pop(value));
+  ASSERT_EQ(q.size_approx(), 0U);
+}
+
+TEST(ConcurrentQueueTest, Spsc_Two_Threads) {
+  const int count = 200000;
+  s21::spsc_queue<int> q(64);
+  std::thread producer([&q] {
+    int batch[8];
+    for (int next = 0; next < count;) {
+      int n = 0;
+      while (n < 8 && next + n < count) {
+        batch[n] = next + n;
+        ++n;
+      }
+      int pushed = static_cast<int>(q.try_push_many(batch, batch + n));
+      if (pushed == 0) std::this_thread::yield();  // Очередь полна
+      next += pushed;
+    }
+  });
+  long long sum = 0;
+  for (int expected = 0; expected < count;) {
+    int value;
+    if (q.try_pop(value)) {
+      ASSERT_EQ(value, expected);  // Порядок сохраняется
+      sum += value;
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  ASSERT_EQ(sum, 1LL * count * (count - 1) / 2);
+}
+
+TEST(ConcurrentQueueTest, Mpmc_Bounded_Move_Only) {
+  s21::mpmc_queue<std::unique_ptr<int>> q(2);
+  ASSERT_TRUE(q.try_push(std::make_unique<int>(1)));
+  ASSERT_TRUE(q.try_emplace(new int(2)));
+  ASSERT_FALSE(q.try_push(std::make_unique<int>(3)));
+  std::unique_ptr<int> value;
+  ASSERT_TRUE(q.try_pop(value));
+  ASSERT_EQ(*value, 1);
+  ASSERT_TRUE(q.try_push(std::make_unique<int>(3)));
+  ASSERT_EQ(q.size_approx(), 2U);
+  // Оставшиеся элементы освобождает деструктор очереди (проверяет ASan)
+}
+
+TEST(ConcurrentQueueTest, Mpmc_Many_Threads) {
+  const int producers = 4;
+  const int per_producer = 50000;
+  s21::mpmc_queue<int> q(128);
+  std::atomic<long long> sum{0};
+  std::atomic<int> received{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&q, p] {
+      std::vector<int> batch;
+      for (int i = 0; i < per_producer;) {
+        batch.clear();
+        for (int k = i; k < per_producer && k < i + 16; ++k) {
+          batch.push_back(p * per_producer + k);
+        }
+        int pushed =
+            static_cast<int>(q.try_push_many(batch.begin(), batch.end()));
+        if (pushed == 0) std::this_thread::yield();
+        i += pushed;
+      }
+    });
+  }
+  for (int c = 0; c < 4; ++c) {
+    threads.emplace_back([&] {
+      int buffer[16];
+      while (received.load() < producers * per_producer) {
+        int n = static_cast<int>(q.try_pop_many(buffer, 16));
+        if (n == 0) std::this_thread::yield();
+        for (int i = 0; i < n; ++i) sum += buffer[i];
+        received += n;
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  const long long total = producers * per_producer;
+  ASSERT_EQ(received.load(), total);
+  ASSERT_EQ(sum.load(), total * (total - 1) / 2);
+  ASSERT_EQ(q.size_approx(), 0U);
+}
+
 // vector_tests
 TEST(VectorTest, DefaultConstructor) {
   s21::vector<int> v;
@@ -933,6 +1190,226 @@ TEST(VectorInsertTest1, InsertSingleElement) {
   }
 }
 
+TEST(VectorTest, Pmr_Resource) {
+  counting_resource first;
+  counting_resource second;
+  {
+    s21::pmr::vector<int> s21_vec(&first);
+    for (int i = 0; i < 100; ++i) s21_vec.push_back(i);
+    ASSERT_GT(first.in_use, 0U);
+    s21::pmr::vector<int> moved(&second);
+    // Аллокаторы разные и не распространяются: элементы переносятся в
+    // память второго ресурса
+    moved = std::move(s21_vec);
+    ASSERT_TRUE(moved.get_allocator().resource() == &second);
+    ASSERT_GT(second.in_use, 0U);
+    ASSERT_EQ(moved.size(), 100U);
+    ASSERT_EQ(moved[99], 99);
+  }
+  ASSERT_EQ(first.in_use, 0U);
+  ASSERT_EQ(second.in_use, 0U);
+}
+
+TEST(VectorTest, Pool_Allocator_Propagation) {
+  using pool_vector = s21::vector<int, s21::pool_allocator<int>>;
+  pool_vector first = {1, 2, 3};
+  pool_vector second = {4, 5};
+  auto first_alloc = first.get_allocator();
+  // propagate_on_container_swap: аллокаторы меняются вместе с элементами
+  first.swap(second);
+  ASSERT_TRUE(second.get_allocator() == first_alloc);
+  ASSERT_EQ(second.size(), 3U);
+  // Копия получает свой пул, а копирующее присваивание его не меняет
+  pool_vector copy(second);
+  ASSERT_TRUE(copy.get_allocator() != second.get_allocator());
+  auto copy_alloc = copy.get_allocator();
+  copy = first;
+  ASSERT_TRUE(copy.get_allocator() == copy_alloc);
+  ASSERT_EQ(copy[1], 5);
+}
+
+// Тип без конструктора по умолчанию, считающий живые объекты
+struct Counted {
+  static int alive;
+  explicit Counted(int v) : value(v) { ++alive; }
+  Counted(const Counted& other) : value(other.value) { ++alive; }
+  Counted& operator=(const Counted& other) = default;
+  ~Counted() { --alive; }
+  int value;
+};
+int Counted::alive = 0;
+
+TEST(VectorTest, Reserve_Constructs_Only_Live) {
+  {
+    s21::vector<Counted> v;
+    v.push_back(Counted(1));
+    v.push_back(Counted(2));
+    v.push_back(Counted(3));
+    v.reserve(1000);  // Запас емкости не содержит объектов
+    ASSERT_EQ(Counted::alive, 3);
+    v.insert(v.begin() + 1, Counted(4));
+    v.erase(v.begin());
+    v.pop_back();
+    ASSERT_EQ(Counted::alive, 2);
+    v.shrink_to_fit();
+    ASSERT_EQ(v.capacity(), 2U);
+    ASSERT_EQ(v[0].value, 4);
+    ASSERT_EQ(v[1].value, 2);
+    v.insert_many_back(Counted(5), Counted(6));
+    v.insert_many(v.begin(), Counted(7));
+    ASSERT_EQ(Counted::alive, 5);
+    ASSERT_EQ(v[0].value, 7);
+    ASSERT_EQ(v[4].value, 6);
+    v.clear();
+    ASSERT_EQ(Counted::alive, 0);
+    ASSERT_GE(v.capacity(), 5U);
+  }
+  ASSERT_EQ(Counted::alive, 0);
+}
+
+TEST(VectorTest, Push_Back_Own_Element) {
+  s21::vector<std::string> v{"first", "second"};
+  v.shrink_to_fit();
+  // Буфер переполнен: ссылка на элемент должна пережить перевыделение
+  v.push_back(v[0]);
+  v.insert(v.begin(), v[2]);
+  ASSERT_EQ(v.size(), 4U);
+  ASSERT_EQ(v[0], "first");
+  ASSERT_EQ(v[3], "first");
+}
+
+TEST(VectorTest, Move_Only_Elements) {
+  s21::vector<std::unique_ptr<int>> v;
+  auto first = std::make_unique<int>(1);
+  v.push_back(std::move(first));
+  ASSERT_EQ(first, nullptr);
+  int& value = *v.emplace_back(new int(3));
+  ASSERT_EQ(value, 3);
+  v.insert(v.begin() + 1, std::make_unique<int>(2));
+  auto it = v.emplace(v.begin(), new int(0));
+  ASSERT_EQ(**it, 0);
+  for (int i = 4; i < 100; ++i) v.emplace_back(new int(i));
+  ASSERT_EQ(v.size(), 100U);
+  for (int i = 0; i < 100; ++i) ASSERT_EQ(*v[i], i);
+}
+
+TEST(VectorTest, Move_Own_Element) {
+  s21::vector<std::string> v{"first", "second"};
+  v.shrink_to_fit();
+  // Перемещаемый элемент живет в старом буфере, который освобождается
+  v.push_back(std::move(v[0]));
+  ASSERT_EQ(v.back(), "first");
+  v.shrink_to_fit();
+  v.insert(v.begin(), std::move(v[1]));
+  ASSERT_EQ(v.front(), "second");
+  v.shrink_to_fit();
+  v.emplace(v.begin() + 1, v[3], 0, 3);  // Подстрока элемента
+  v.shrink_to_fit();
+  std::string& tail = v.emplace_back(v[0]);
+  ASSERT_EQ(tail, "second");
+  ASSERT_EQ(v.size(), 6U);
+  ASSERT_EQ(v[1], "fir");
+  ASSERT_EQ(v[4], "first");
+}
+
+TEST(VectorTest, Nested_Containers_Relocate) {
+  // Перемещение забирает буфер и не бросает исключений, поэтому внешний
+  // вектор переносит вложенные контейнеры перемещением, а не копией
+  static_assert(std::is_nothrow_move_constructible_v<s21::vector<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::queue<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::stack<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<
+                s21::queue<int, std::allocator<int>, s21::ring_storage<>>>);
+  static_assert(std::is_nothrow_move_constructible_v<
+                s21::stack<int, std::allocator<int>, s21::array_storage<4>>>);
+  // Встроенные ячейки не передать: их элементы перемещаются по одному
+  struct throwing_move {
+    throwing_move() = default;
+    throwing_move(throwing_move&&) {}
+  };
+  static_assert(!std::is_nothrow_move_constructible_v<s21::stack<
+                    throwing_move, std::allocator<throwing_move>,
+                    s21::array_storage<4>>>);
+  s21::vector<s21::vector<int>> v;
+  v.emplace_back(s21::vector<int>{1, 2, 3});
+  const int* inner = v[0].data();
+  for (int i = 0; i < 100; ++i) v.emplace_back();
+  ASSERT_EQ(v[0].data(), inner);
+  ASSERT_EQ(v[0][2], 3);
+}
+
+TEST(VectorTest, PopBack_Keeps_Capacity) {
+  s21::vector<int> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  size_t capacity = v.capacity();
+  int* data = v.data();
+  while (!v.empty()) v.pop_back();
+  // Политика по умолчанию буфер не сжимает
+  ASSERT_EQ(v.capacity(), capacity);
+  ASSERT_EQ(v.data(), data);
+}
+
+TEST(VectorTest, Shrinking_Policy) {
+  s21::vector<int, std::allocator<int>, s21::shrinking_policy> v;
+  for (int i = 0; i < 1024; ++i) v.push_back(i);
+  ASSERT_EQ(v.capacity(), 1024U);
+  // Колебания около границы не перевыделяют буфер
+  int* data = v.data();
+  for (int i = 0; i < 100; ++i) {
+    v.pop_back();
+    v.push_back(i);
+  }
+  ASSERT_EQ(v.data(), data);
+  while (v.size() > 256) v.pop_back();
+  ASSERT_EQ(v.capacity(), 512U);  // Заполнено на четверть: сжатие вдвое
+  while (v.size() > 3) v.pop_back();
+  ASSERT_LE(v.capacity(), 16U);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[2], 2);
+  v.erase(v.begin());
+  v.pop_back();
+  v.pop_back();
+  ASSERT_TRUE(v.empty());
+  ASSERT_LE(v.capacity(), 2U);
+}
+
+TEST(VectorTest, Growth_Factor) {
+  s21::vector<int, std::allocator<int>, s21::growth_policy<3, 2>> v;
+  v.reserve(10);
+  for (int i = 0; i < 11; ++i) v.push_back(i);
+  ASSERT_EQ(v.capacity(), 15U);
+  v.insert_many_back(1, 2, 3, 4, 5, 6, 7, 8, 9, 10);  // Нужно больше 1.5x
+  ASSERT_EQ(v.capacity(), 21U);
+}
+
+// Владеет объектом через указатель: тип не тривиально копируем, но его
+// можно переносить побайтно
+struct Boxed {
+  std::unique_ptr<int> value;
+};
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<Boxed> : std::true_type {};
+}  // namespace s21
+
+TEST(VectorTest, Trivially_Relocatable_Type) {
+  s21::vector<Boxed> v;
+  for (int i = 0; i < 10; ++i) {
+    v.insert_many_back(Boxed{std::make_unique<int>(i)});
+  }
+  v.insert_many(v.begin() + 2, Boxed{std::make_unique<int>(100)},
+                Boxed{std::make_unique<int>(101)});
+  v.erase(v.begin());
+  v.reserve(100);
+  v.shrink_to_fit();
+  std::vector<int> expected = {1, 100, 101, 2, 3, 4, 5, 6, 7, 8, 9};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(*v[i].value, expected[i]);
+  }
+}
+
 // tests_stack
 TEST(Stack_Constructor, Default_Empty) {
   s21::stack<int> s21_stack;
@@ -1170,6 +1647,82 @@ TEST(Stack_Operator, Assignment_New2) {
   ASSERT_EQ(s21_stack2.top(), std_stack2.top());
 }
 
+TEST(Stack_Operator, Pmr_Resource) {
+  counting_resource resource;
+  {
+    s21::pmr::stack<int> s21_stack(&resource);
+    for (int i = 0; i < 10; ++i) s21_stack.push(i);
+    s21::pmr::stack<int> copy(&resource);
+    copy = s21_stack;
+    ASSERT_TRUE(copy.get_allocator().resource() == &resource);
+    ASSERT_EQ(copy.size(), 10U);
+    while (!copy.empty() && copy.top() == s21_stack.top()) {
+      copy.pop();
+      s21_stack.pop();
+    }
+    ASSERT_TRUE(copy.empty());
+  }
+  ASSERT_EQ(resource.in_use, 0U);
+}
+
+TEST(Stack_Modifiers, Emplace_Move_Only) {
+  s21::stack<std::unique_ptr<std::string>> s;
+  s.push(std::make_unique<std::string>("one"));
+  s.emplace(new std::string(3, 'x'));
+  ASSERT_EQ(*s.top(), "xxx");
+  s.insert_many_back(std::make_unique<std::string>("two"));
+  ASSERT_EQ(s.size(), 3U);
+  ASSERT_EQ(*s.top(), "two");
+}
+
+TEST(Stack_Modifiers, Array_Inline_Buffer) {
+  counting_resource resource;
+  s21::pmr::stack<int, s21::array_storage<4>> s(&resource);
+  std::stack<int> s_;
+  for (int i = 0; i < 4; ++i) {
+    s.push(i);
+    s_.push(i);
+  }
+  ASSERT_EQ(resource.in_use, 0U);  // Первые элементы лежат в самом стеке
+  for (int i = 4; i < 100; ++i) {
+    s.push(i);
+    s_.push(i);
+  }
+  ASSERT_GT(resource.in_use, 0U);
+  auto copy = s;
+  ASSERT_EQ(copy.size(), s_.size());
+  while (!s_.empty()) {
+    ASSERT_EQ(copy.top(), s_.top());
+    copy.pop();
+    s_.pop();
+  }
+  ASSERT_THROW(copy.pop(), std::exception);
+}
+
+TEST(Stack_Modifiers, Array_Swap_And_Move) {
+  using array_stack = s21::stack<std::string, std::allocator<std::string>,
+                                 s21::array_storage<2>>;
+  array_stack small = {"a"};
+  array_stack large = {"b", "c", "d", "e"};
+  small.swap(large);  // Встроенные ячейки и выделенный массив
+  ASSERT_EQ(small.size(), 4U);
+  ASSERT_EQ(small.top(), "e");
+  ASSERT_EQ(large.top(), "a");
+  array_stack moved(std::move(small));
+  ASSERT_TRUE(small.empty());
+  ASSERT_EQ(moved.top(), "e");
+  moved = std::move(large);
+  ASSERT_EQ(moved.size(), 1U);
+  ASSERT_EQ(moved.top(), "a");
+  moved.push(moved.top());  // Аргумент ссылается на элемент стека
+  moved.push(moved.top());
+  ASSERT_EQ(moved.size(), 3U);
+  ASSERT_EQ(moved.top(), "a");
+  array_stack copy;
+  copy = moved;
+  ASSERT_EQ(copy.size(), 3U);
+}
+
 // tests_set
 TEST(set_Iterator, End) {
   s21::set<int> s21_mset = {5, 7, 3, 4, 2, 6, 8};
@@ -1181,6 +1734,106 @@ TEST(set_Iterator, End) {
   ASSERT_EQ(*s21_iterator, *std_iterator);
 }
 
+TEST(set_Iterator, Reverse_From_End) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 200; ++i) {
+    s21_set.insert(i * 37 % 101);
+    std_set.insert(i * 37 % 101);
+  }
+  auto s21_it = s21_set.end();
+  for (auto std_it = std_set.rbegin(); std_it != std_set.rend(); ++std_it) {
+    --s21_it;
+    ASSERT_EQ(*s21_it, *std_it);
+  }
+  ASSERT_EQ(s21_it, s21_set.begin());
+}
+
+TEST(set_Iterator, End_Does_Not_Touch_Tree) {
+  // end() не помечает узлы: дерево остается сбалансированным при любом
+  // чередовании end() со вставками и удалениями максимума
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 300; ++i) {
+    ASSERT_EQ(s21_set.find(-1), s21_set.end());
+    s21_set.insert(i);
+    std_set.insert(i);
+    if (i % 3 == 0) {
+      s21_set.erase(--s21_set.end());
+      std_set.erase(--std_set.end());
+    }
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it) {
+    ASSERT_EQ(*it, *std_it);
+  }
+  ASSERT_EQ(*s21_set.begin(), *std_set.begin());
+}
+
+TEST(set_Iterator, Const_Iterator) {
+  const s21::set<int> s21_set = {5, 1, 4, 2, 3};
+  static_assert(std::is_same_v<decltype(*s21_set.begin()), const int&>);
+  static_assert(std::is_same_v<decltype(s21_set.find(1)),
+                               s21::set<int>::const_iterator>);
+  int expected = 1;
+  for (auto it = s21_set.cbegin(); it != s21_set.cend(); ++it) {
+    ASSERT_EQ(*it, expected++);
+  }
+  auto last = s21_set.cend();
+  ASSERT_EQ(*--last, 5);
+  // Обычный итератор приводится к константному
+  s21::set<int> mutable_set = {1, 2};
+  s21::set<int>::const_iterator it = mutable_set.begin();
+  ASSERT_EQ(*++it, 2);
+  ASSERT_EQ(++it, mutable_set.cend());
+}
+
+TEST(set_Iterator, Const_Iterator_One_Way) {
+  using set = s21::set<int>;
+  using map = s21::map<int, int>;
+  // Константный итератор нельзя превратить в изменяемый
+  static_assert(std::is_convertible_v<set::iterator, set::const_iterator>);
+  static_assert(!std::is_convertible_v<set::const_iterator, set::iterator>);
+  static_assert(std::is_convertible_v<map::iterator, map::const_iterator>);
+  static_assert(!std::is_convertible_v<map::const_iterator, map::iterator>);
+  static_assert(std::is_same_v<decltype(*std::declval<map::const_iterator>()),
+                               const std::pair<const int, int>&>);
+  set s21_set = {1, 2, 3};
+  set::iterator it = s21_set.find(2);
+  set::const_iterator cit = std::as_const(s21_set).find(2);
+  ASSERT_TRUE(it == cit);
+  ASSERT_TRUE(cit == it);
+  ASSERT_TRUE(s21_set.begin() != cit);
+  // Удаление и вставка с подсказкой принимают оба вида итераторов
+  s21_set.erase(cit);
+  s21_set.insert(s21_set.cend(), 4);
+  s21_set.erase(s21_set.begin());
+  ASSERT_EQ(s21_set.size(), 2U);
+  ASSERT_EQ(*s21_set.begin(), 3);
+  map s21_map = {{1, 10}, {2, 20}};
+  map::iterator found = s21_map.find(2);
+  (*found).second = 21;
+  s21_map.erase(std::as_const(s21_map).find(1));
+  ASSERT_EQ(s21_map.size(), 1U);
+  ASSERT_EQ(s21_map.at(2), 21);
+}
+
+TEST(set_Iterator, Std_Algorithms) {
+  using set = s21::set<int>;
+  static_assert(std::is_same_v<
+                std::iterator_traits<set::const_iterator>::iterator_category,
+                std::bidirectional_iterator_tag>);
+  static_assert(std::is_same_v<std::iterator_traits<set::iterator>::reference,
+                               int&>);
+  const set s21_set = {4, 1, 3, 2};
+  ASSERT_EQ(*std::prev(s21_set.cend()), 4);
+  ASSERT_EQ(std::distance(s21_set.begin(), s21_set.end()), 4);
+  ASSERT_EQ(*std::find(s21_set.cbegin(), s21_set.cend(), 3), 3);
+  std::reverse_iterator<set::const_iterator> last(s21_set.cend());
+  ASSERT_EQ(*last, 4);
+}
+
 TEST(set_Capacity, Max_Size) {
   s21::set<int> s21_set = {1, 2, 3};
   std::set<int> std_set = {1, 2, 3};
@@ -2896,6 +3549,531 @@ TEST(set_Lookup, Contains_False) {
   ASSERT_EQ(s21_set.contains(9.9), 0);
 }
 
+TEST(set_Lookup, Find_Large) {
+  s21::set<int> s21_set;
+  for (int i = 0; i < 10000; i += 2) s21_set.insert(i);
+  for (int i = 0; i < 10000; ++i) {
+    ASSERT_EQ(s21_set.contains(i), i % 2 == 0);
+  }
+  ASSERT_EQ(*s21_set.find(5000), 5000);
+}
+
+TEST(set_Modifiers, Insert_Returns_New_Node) {
+  s21::set<int> s21_set = {5, 1, 9};
+  auto result = s21_set.insert(4);
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ(*result.first, 4);
+  auto again = s21_set.insert(4);
+  ASSERT_FALSE(again.second);
+  ASSERT_EQ(again.first, result.first);
+}
+
+TEST(set_Modifiers, Insert_Hint_Sorted) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 1000; ++i) {
+    s21_set.insert(s21_set.end(), i);
+    std_set.insert(std_set.end(), i);
+  }
+  auto it = s21_set.insert(s21_set.begin(), -1);  // Верная подсказка
+  ASSERT_EQ(*it, -1);
+  it = s21_set.insert(s21_set.begin(), 500);  // Неверная подсказка
+  ASSERT_EQ(*it, 500);
+  it = s21_set.emplace_hint(s21_set.find(700), 699);  // Уже существует
+  ASSERT_EQ(*it, 699);
+  std_set.insert(-1);
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto s21_it = s21_set.begin();
+  for (auto std_it = std_set.begin(); std_it != std_set.end(); ++std_it) {
+    ASSERT_EQ(*s21_it++, *std_it);
+  }
+}
+
+TEST(set_Allocator, Pool_Reuses_Freed_Nodes) {
+  s21::pool_allocator<int> alloc;
+  int* first = alloc.allocate(1);
+  alloc.deallocate(first, 1);
+  int* second = alloc.allocate(1);
+  ASSERT_EQ(first, second);  // Блок вернулся из списка свободных
+  alloc.deallocate(second, 1);
+  int* array = alloc.allocate(10);  // Массивы выделяются мимо пула
+  array[9] = 1;
+  alloc.deallocate(array, 10);
+}
+
+TEST(set_Allocator, Pool_Set) {
+  using pool_set = s21::set<int, std::less<int>, s21::pool_allocator<int>>;
+  pool_set s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 2000; ++i) {
+    s21_set.insert((i * 7919) % 2000);
+    std_set.insert((i * 7919) % 2000);
+  }
+  for (int i = 0; i < 2000; i += 3) {
+    s21_set.erase(s21_set.find(i));
+    std_set.erase(i);
+  }
+  pool_set copy(s21_set);
+  ASSERT_TRUE(copy.get_allocator() != s21_set.get_allocator());
+  s21_set.clear();  // Пул принадлежит только s21_set: освобождается целиком
+  ASSERT_TRUE(s21_set.empty());
+  for (int i = 0; i < 10; ++i) s21_set.insert(i);
+  ASSERT_EQ(s21_set.size(), 10U);
+  ASSERT_EQ(copy.size(), std_set.size());
+  auto s21_it = copy.begin();
+  for (auto std_it = std_set.begin(); std_it != std_set.end(); ++std_it) {
+    ASSERT_EQ(*s21_it++, *std_it);
+  }
+}
+
+TEST(set_Allocator, Pool_Shared_Allocator) {
+  s21::pool_allocator<std::string> alloc;
+  s21::set<std::string, std::less<std::string>,
+           s21::pool_allocator<std::string>> first(alloc);
+  s21::set<std::string, std::less<std::string>,
+           s21::pool_allocator<std::string>> second(alloc);
+  ASSERT_TRUE(first.get_allocator() == alloc);
+  for (int i = 0; i < 100; ++i) {
+    first.insert(std::string(40, static_cast<char>('a' + i % 26)) +
+                 std::to_string(i));
+    second.insert(std::to_string(i));
+  }
+  // Пул общий, поэтому clear освобождает узлы поштучно
+  first.clear();
+  ASSERT_EQ(second.size(), 100U);
+  ASSERT_TRUE(second.contains("42"));
+}
+
+TEST(set_Allocator, Pmr_Resource) {
+  counting_resource first;
+  counting_resource second;
+  {
+    s21::pmr::set<int> s21_set(&first);
+    for (int i = 0; i < 100; ++i) s21_set.insert(i);
+    // Копия выбирает аллокатор через select_on_container_copy_construction
+    s21::pmr::set<int> copy(s21_set);
+    ASSERT_TRUE(copy.get_allocator().resource() ==
+                std::pmr::get_default_resource());
+    s21::pmr::set<int> moved(&second);
+    moved = std::move(s21_set);
+    ASSERT_TRUE(moved.get_allocator().resource() == &second);
+    ASSERT_TRUE(s21_set.empty());
+    ASSERT_EQ(first.in_use, 0U);  // Узлы перенесены поштучно и освобождены
+    ASSERT_EQ(moved.size(), copy.size());
+  }
+  ASSERT_EQ(second.in_use, 0U);
+}
+
+// Перемещающее присваивание noexcept, только если всегда забирает память:
+// с pmr при разных ресурсах элементы переносятся с выделением памяти
+template <typename... Containers>
+constexpr bool nothrow_move_v =
+    (std::is_nothrow_move_assignable_v<Containers> && ...);
+
+TEST(set_Allocator, Move_Assign_Noexcept) {
+  using pool = s21::pool_allocator<int>;
+  static_assert(nothrow_move_v<s21::set<int>, s21::map<int, int>,
+                               s21::list<int>, s21::vector<int>,
+                               s21::btree_set<int>, s21::flat_set<int>,
+                               s21::unordered_set<int>>);
+  static_assert(nothrow_move_v<s21::set<int, std::less<int>, pool>,
+                               s21::list<int, pool>, s21::vector<int, pool>,
+                               s21::btree_set<int, pool>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::set<int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::map<int, int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::list<int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::vector<int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::btree_set<int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::flat_set<int>>);
+  static_assert(
+      !std::is_nothrow_move_assignable_v<s21::pmr::unordered_set<int>>);
+}
+
+TEST(set_Allocator, Pool_Swap_Propagates) {
+  using pool_set = s21::set<int, std::less<int>, s21::pool_allocator<int>>;
+  pool_set first = {1, 2, 3};
+  pool_set second = {4};
+  auto first_alloc = first.get_allocator();
+  first.swap(second);
+  ASSERT_TRUE(second.get_allocator() == first_alloc);
+  pool_set target;
+  target = std::move(second);  // Перемещение забирает пул вместе с узлами
+  ASSERT_TRUE(target.get_allocator() == first_alloc);
+  ASSERT_EQ(target.size(), 3U);
+}
+
+TEST(set_Modifiers, Emplace) {
+  s21::set<std::string> s;
+  auto first = s.emplace(3, 'a');
+  ASSERT_TRUE(first.second);
+  ASSERT_EQ(*first.first, "aaa");
+  std::string key = "aaa";
+  auto second = s.emplace(std::move(key));
+  ASSERT_FALSE(second.second);
+  ASSERT_EQ(key, "aaa");  // Ключ уже есть: аргумент не перемещен
+  s.emplace_hint(s.begin(), "b");
+  ASSERT_EQ(s.size(), 2U);
+  ASSERT_TRUE(s.contains("b"));
+}
+
+TEST(set_Lookup, Bounds) {
+  s21::set<int> s21_set = {10, 20, 30, 40};
+  std::set<int> std_set = {10, 20, 30, 40};
+  ASSERT_EQ(*s21_set.lower_bound(20), *std_set.lower_bound(20));
+  ASSERT_EQ(*s21_set.lower_bound(25), *std_set.lower_bound(25));
+  ASSERT_EQ(*s21_set.upper_bound(20), *std_set.upper_bound(20));
+  ASSERT_EQ(*s21_set.upper_bound(5), *std_set.upper_bound(5));
+  ASSERT_EQ(s21_set.lower_bound(50), s21_set.end());
+  ASSERT_EQ(s21_set.upper_bound(40), s21_set.end());
+  auto range = s21_set.equal_range(30);
+  ASSERT_EQ(*range.first, 30);
+  ASSERT_EQ(*range.second, 40);
+}
+
+TEST(set_Constructor, Range_Unsorted) {
+  std::mt19937 rng(18);
+  std::vector<int> keys;
+  for (int i = 0; i < 5000; ++i) keys.push_back(static_cast<int>(rng() % 3000));
+  s21::set<int> s21_set(keys.begin(), keys.end());
+  std::set<int> std_set(keys.begin(), keys.end());
+  // Построенное дерево дальше меняется обычными вставками и удалениями
+  for (int i = 0; i < 5000; ++i) {
+    int key = static_cast<int>(rng() % 3000);
+    if (i % 2 == 0) {
+      s21_set.insert(key);
+      std_set.insert(key);
+    } else if (s21_set.contains(key)) {
+      s21_set.erase(s21_set.find(key));
+      std_set.erase(key);
+    }
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto s21_it = s21_set.begin();
+  for (int key : std_set) ASSERT_EQ(*s21_it++, key);
+}
+
+TEST(set_Constructor, Range_Sorted_Copy) {
+  std::vector<int> keys;
+  for (int i = 0; i < 10000; ++i) keys.push_back(i);
+  s21::set<int> original(keys.begin(), keys.end());
+  s21::set<int> copy(original);
+  original.erase(original.begin());
+  ASSERT_EQ(copy.size(), 10000U);
+  ASSERT_EQ(*copy.begin(), 0);
+  ASSERT_EQ(*original.begin(), 1);
+  for (int i = 0; i < 10000; ++i) ASSERT_TRUE(copy.contains(i));
+}
+
+TEST(set_Modifiers, Merge_Large) {
+  s21::set<int> s21_set1, s21_set2;
+  std::set<int> std_set1, std_set2;
+  for (int i = 0; i < 3000; ++i) {
+    s21_set1.insert(2 * i);
+    std_set1.insert(2 * i);
+    s21_set2.insert(3 * i);
+    std_set2.insert(3 * i);
+  }
+  s21_set1.merge(s21_set2);
+  std_set1.merge(std_set2);
+  // В other остаются элементы, ключи которых уже были в множестве
+  ASSERT_EQ(s21_set1.size(), std_set1.size());
+  ASSERT_EQ(s21_set2.size(), std_set2.size());
+  auto s21_it = s21_set1.begin();
+  for (int key : std_set1) ASSERT_EQ(*s21_it++, key);
+  s21_it = s21_set2.begin();
+  for (int key : std_set2) ASSERT_EQ(*s21_it++, key);
+  s21_set1.merge(s21_set1);
+  ASSERT_EQ(s21_set1.size(), std_set1.size());
+}
+
+TEST(set_Constructor, Copy_Independent) {
+  std::mt19937 rng(19);
+  s21::set<int> original;
+  std::set<int> std_set;
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(rng() % 10000);
+    original.insert(key);
+    std_set.insert(key);
+  }
+  s21::set<int> copy(original);
+  // Копия и оригинал не делят узлы
+  for (int key : std_set) {
+    if (key % 2 == 0) copy.erase(copy.find(key));
+  }
+  copy.insert(-1);
+  ASSERT_EQ(original.size(), std_set.size());
+  auto it = original.begin();
+  for (int key : std_set) ASSERT_EQ(*it++, key);
+  it = copy.begin();
+  ASSERT_EQ(*it++, -1);
+  for (int key : std_set) {
+    if (key % 2 != 0) {
+      ASSERT_EQ(*it++, key);
+    }
+  }
+}
+
+TEST(set_Modifiers, Merge_Steals_Nodes) {
+  s21::set<int> s21_set1 = {1, 3, 5};
+  s21::set<int> s21_set2 = {2, 3, 4};
+  const int* two = &*s21_set2.find(2);
+  const int* three = &*s21_set2.find(3);
+  s21_set1.merge(s21_set2);
+  // Узлы перешли без копирования, повтор ключа остался на месте
+  ASSERT_EQ(&*s21_set1.find(2), two);
+  ASSERT_EQ(s21_set1.size(), 5U);
+  ASSERT_EQ(s21_set2.size(), 1U);
+  ASSERT_EQ(&*s21_set2.find(3), three);
+}
+
+TEST(set_Modifiers, Merge_Across_Resources) {
+  counting_resource first;
+  counting_resource second;
+  s21::pmr::set<int> s21_set1(&first);
+  s21::pmr::set<int> s21_set2(&second);
+  for (int i = 0; i < 100; ++i) {
+    s21_set1.insert(2 * i);
+    s21_set2.insert(3 * i);
+  }
+  std::size_t before = second.in_use;
+  // Память разная: элементы копируются в узлы своего ресурса
+  s21_set1.merge(s21_set2);
+  ASSERT_EQ(s21_set1.size(), 166U);
+  ASSERT_EQ(s21_set2.size(), 34U);
+  ASSERT_LT(second.in_use, before);
+  s21_set1.clear();
+  ASSERT_EQ(first.in_use, 0U);
+}
+
+template <typename Op>
+static void CheckSetAlgebra(const std::set<int>& lhs, const std::set<int>& rhs,
+                            Op op, s21::set<int> (s21::set<int>::*method)(
+                                       const s21::set<int>&) const) {
+  std::vector<int> expected;
+  op(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+     std::back_inserter(expected));
+  s21::set<int> s21_lhs(lhs.begin(), lhs.end());
+  s21::set<int> s21_rhs(rhs.begin(), rhs.end());
+  s21::set<int> result = (s21_lhs.*method)(s21_rhs);
+  ASSERT_EQ(result.size(), expected.size());
+  auto it = result.begin();
+  for (int key : expected) ASSERT_EQ(*it++, key);
+  ASSERT_EQ(s21_lhs.size(), lhs.size());  // Операнды не меняются
+}
+
+TEST(set_Algebra, Matches_Std) {
+  std::mt19937 rng(20);
+  for (int size : {0, 1, 10, 500, 3000}) {
+    std::set<int> lhs, rhs;
+    for (int i = 0; i < size; ++i) {
+      lhs.insert(static_cast<int>(rng() % (2 * size + 1)));
+      rhs.insert(static_cast<int>(rng() % (2 * size + 1)));
+    }
+    using It = std::set<int>::const_iterator;
+    using Out = std::back_insert_iterator<std::vector<int>>;
+    CheckSetAlgebra(lhs, rhs, std::set_union<It, It, Out>,
+                    &s21::set<int>::set_union);
+    CheckSetAlgebra(lhs, rhs, std::set_intersection<It, It, Out>,
+                    &s21::set<int>::set_intersection);
+    CheckSetAlgebra(lhs, rhs, std::set_difference<It, It, Out>,
+                    &s21::set<int>::set_difference);
+    CheckSetAlgebra(rhs, lhs, std::set_difference<It, It, Out>,
+                    &s21::set<int>::set_difference);
+    CheckSetAlgebra(lhs, rhs, std::set_symmetric_difference<It, It, Out>,
+                    &s21::set<int>::set_symmetric_difference);
+  }
+}
+
+TEST(set_Algebra, Skewed_Sizes) {
+  std::set<int> large, small;
+  for (int i = 0; i < 100000; ++i) large.insert(2 * i);
+  for (int i = 0; i < 50; ++i) small.insert(i * 3999);
+  using It = std::set<int>::const_iterator;
+  using Out = std::back_insert_iterator<std::vector<int>>;
+  // Длинные участки большого дерева перескакиваются спуском от корня
+  CheckSetAlgebra(large, small, std::set_intersection<It, It, Out>,
+                  &s21::set<int>::set_intersection);
+  CheckSetAlgebra(small, large, std::set_intersection<It, It, Out>,
+                  &s21::set<int>::set_intersection);
+  CheckSetAlgebra(small, large, std::set_difference<It, It, Out>,
+                  &s21::set<int>::set_difference);
+}
+
+TEST(set_Allocator, Pool_Reserve_Contiguous) {
+  s21::pool_allocator<long> alloc;
+  alloc.reserve(1000);  // Больше, чем помещается в один кусок пула
+  long* previous = alloc.allocate(1);
+  for (int i = 1; i < 1000; ++i) {
+    long* next = alloc.allocate(1);
+    ASSERT_EQ(reinterpret_cast<char*>(next) - reinterpret_cast<char*>(previous),
+              static_cast<std::ptrdiff_t>(alignof(std::max_align_t)));
+    previous = next;
+  }
+}
+
+// Ключ, который нельзя построить из std::string_view: поиск по string_view
+// компилируется, только если временный ключ не создается
+struct Name {
+  std::string text;
+};
+
+struct name_less {
+  using is_transparent = void;
+  bool operator()(const Name& lhs, const Name& rhs) const {
+    return lhs.text < rhs.text;
+  }
+  bool operator()(const Name& lhs, std::string_view rhs) const {
+    return lhs.text < rhs;
+  }
+  bool operator()(std::string_view lhs, const Name& rhs) const {
+    return lhs < rhs.text;
+  }
+};
+
+// Порядок по остатку от деления: компаратор с состоянием
+struct mod_less {
+  int mod;
+  bool operator()(int lhs, int rhs) const { return lhs % mod < rhs % mod; }
+};
+
+TEST(set_Compare, Greater_Order) {
+  s21::set<int, std::greater<int>> s21_set = {3, 1, 4, 1, 5};
+  std::set<int, std::greater<int>> std_set = {3, 1, 4, 1, 5};
+  auto std_it = std_set.begin();
+  for (int value : s21_set) ASSERT_EQ(value, *std_it++);
+  ASSERT_EQ(std_it, std_set.end());
+  ASSERT_EQ(*s21_set.lower_bound(2), 1);
+  ASSERT_EQ(*s21_set.upper_bound(4), 3);
+  s21::set<int, std::greater<int>> other = {2, 4, 6};
+  s21_set.merge(other);
+  ASSERT_EQ(*s21_set.begin(), 6);
+  ASSERT_EQ(other.size(), 1U);
+  auto both = s21_set.set_intersection({6, 2, 7});
+  ASSERT_EQ(both.size(), 2U);
+  ASSERT_EQ(*both.begin(), 6);
+}
+
+TEST(set_Compare, Stateful_Comparator) {
+  s21::set<int, mod_less> s21_set(mod_less{10});
+  for (int value : {13, 21, 3, 42, 30}) s21_set.insert(value);
+  // 3 эквивалентно 13 по остатку и не вставляется
+  ASSERT_EQ(s21_set.size(), 4U);
+  ASSERT_EQ(*s21_set.begin(), 30);
+  ASSERT_TRUE(s21_set.contains(53));
+  s21::set<int, mod_less> copy(s21_set);
+  ASSERT_EQ(copy.key_comp().mod, 10);
+  s21::set<int, mod_less> other(mod_less{7});
+  other = copy;
+  ASSERT_EQ(other.key_comp().mod, 10);
+  ASSERT_TRUE(other.contains(43));
+}
+
+// Поля set без компаратора: пустой компаратор не должен добавлять к ним
+// ни байта
+struct set_layout {
+  std::allocator<int> alloc;
+  void* root;
+  void* leftmost;
+  void* rightmost;
+  std::size_t size;
+};
+
+TEST(set_Compare, Empty_Comparator_Takes_No_Space) {
+  ASSERT_EQ(sizeof(s21::set<int>), sizeof(set_layout));
+  ASSERT_EQ(sizeof(s21::set<int, std::greater<int>>), sizeof(set_layout));
+  ASSERT_EQ(sizeof(s21::map<int, int>), sizeof(set_layout));
+}
+
+TEST(set_Compare, Transparent_Lookup) {
+  s21::set<Name, name_less> names = {
+      {"beta"}, {"alpha"}, {"gamma"}};
+  const std::string_view key = "beta";
+  ASSERT_TRUE(names.contains(key));
+  ASSERT_EQ((*names.find(key)).text, "beta");
+  ASSERT_EQ(names.count(std::string_view("delta")), 0U);
+  ASSERT_EQ((*names.lower_bound(std::string_view("b"))).text, "beta");
+  ASSERT_EQ(names.upper_bound(std::string_view("gamma")), names.end());
+  auto range = names.equal_range(key);
+  ASSERT_EQ(++range.first, range.second);
+  ASSERT_EQ(names.erase(key), 1U);
+  ASSERT_EQ(names.erase(key), 0U);
+  ASSERT_EQ(names.size(), 2U);
+}
+
+TEST(set_Modifiers, Erase_By_Key) {
+  s21::set<std::string, std::less<>> s21_set = {"a", "b", "c"};
+  ASSERT_EQ(s21_set.count("b"), 1U);
+  ASSERT_EQ(s21_set.erase("b"), 1U);
+  ASSERT_EQ(s21_set.erase(std::string("b")), 0U);
+  s21::set<std::string, std::less<>>::const_iterator first = s21_set.begin();
+  s21_set.erase(first);
+  ASSERT_EQ(s21_set.size(), 1U);
+  ASSERT_EQ(*s21_set.begin(), "c");
+  s21::set<int> plain = {1, 2};
+  ASSERT_EQ(plain.erase(2), 1U);
+  ASSERT_EQ(plain.count(2), 0U);
+}
+
+TEST(set_OrderStatistic, Nth_And_Rank) {
+  s21::ranked::set<int> s21_set;
+  for (int value = 99; value >= 0; --value) s21_set.insert(value * 2);
+  for (size_t k = 0; k < s21_set.size(); ++k) {
+    ASSERT_EQ(*s21_set.nth(k), static_cast<int>(k * 2));
+  }
+  ASSERT_EQ(s21_set.nth(100), s21_set.end());
+  ASSERT_EQ(s21_set.rank(0), 0U);
+  ASSERT_EQ(s21_set.rank(41), 21U);
+  ASSERT_EQ(s21_set.rank(42), 21U);
+  ASSERT_EQ(s21_set.rank(1000), 100U);
+  ASSERT_EQ(s21_set.count_range(10, 20), 5U);
+  ASSERT_EQ(s21_set.count_range(20, 10), 0U);
+  ASSERT_EQ(s21_set.count_range(-5, 500), 100U);
+}
+
+TEST(set_OrderStatistic, Index_And_Distance) {
+  const s21::ranked::set<int> s21_set = {5, 1, 9, 3, 7};
+  ASSERT_EQ(s21_set.index(s21_set.begin()), 0U);
+  ASSERT_EQ(s21_set.index(s21_set.find(7)), 3U);
+  ASSERT_EQ(s21_set.index(s21_set.end()), 5U);
+  ASSERT_EQ(s21_set.distance(s21_set.begin(), s21_set.end()), 5);
+  ASSERT_EQ(s21_set.distance(s21_set.find(9), s21_set.find(3)), -3);
+}
+
+TEST(set_OrderStatistic, Sizes_Follow_Modifications) {
+  s21::ranked::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 500; ++i) {
+    int value = (i * 7919) % 1000;
+    if (i % 3 == 2) {
+      s21_set.erase(value / 2);
+      std_set.erase(value / 2);
+    } else {
+      s21_set.insert(value);
+      std_set.insert(value);
+    }
+  }
+  s21::ranked::set<int> other = {1, 3, 5, 1001, 1003};
+  s21_set.merge(other);
+  std_set.insert({1, 3, 5, 1001, 1003});
+  s21::ranked::set<int> copy(s21_set);
+  size_t k = 0;
+  for (int value : std_set) {
+    ASSERT_EQ(*s21_set.nth(k), value);
+    ASSERT_EQ(*copy.nth(k), value);
+    ASSERT_EQ(s21_set.rank(value), k);
+    ++k;
+  }
+  ASSERT_EQ(s21_set.nth(k), s21_set.end());
+}
+
+TEST(set_OrderStatistic, Plain_Tree_Size_Unchanged) {
+  ASSERT_EQ(sizeof(s21::set<int>), sizeof(s21::ranked::set<int>));
+  s21::set<int, std::greater<int>, std::allocator<int>, true> s21_set = {
+      1, 2, 3, 4};
+  ASSERT_EQ(*s21_set.nth(0), 4);
+  ASSERT_EQ(s21_set.rank(2), 2U);
+}
+
 TEST(Multiset_Modifiers, Erase_SingleElement) {
   s21::set<int> s21_set = {42};
   std::set<int> std_set = {42};
@@ -2997,7 +4175,7 @@ TEST(Multiset_Modifiers, Erase_DuplicateElements) {
 
 TEST(Multiset_Erase, NullIterator) {
   s21::set<int> s21_set = {10, 20, 30};
-  s21::set<int>::iterator null_iter = nullptr;
+  s21::set<int>::iterator null_iter;
 
   s21_set.erase(null_iter);
 
@@ -4021,8 +5199,8 @@ TEST(MultisetTest, InsertMany_DuplicateValues) {
       5);  // Проверка, что размер увеличился на 2, так как 3 уже существует
 
   // Проверка значений и успешности вставки
-  EXPECT_TRUE(results[0].second);  // 3 уже существует, не должно быть вновь
-                                   // вставлено (это для set здесь false)
+  EXPECT_FALSE(results[0].second);  // 3 уже существует, не должно быть вновь
+                                    // вставлено
   EXPECT_TRUE(results[1].second);  // 4 — новое значение
   EXPECT_TRUE(results[2].second);  // 5 — новое значение
 }
@@ -4357,6 +5535,21 @@ TEST(Map_Element_Access, Brackets_Empty) {
 
 // Iterators
 
+TEST(Map_Iterators, Std_Algorithms) {
+  using map = s21::map<int, char>;
+  static_assert(std::is_same_v<
+                std::iterator_traits<map::const_iterator>::iterator_category,
+                std::bidirectional_iterator_tag>);
+  static_assert(std::is_same_v<std::iterator_traits<map::iterator>::value_type,
+                               std::pair<const int, char>>);
+  map s21_map = {{2, 'b'}, {1, 'a'}, {3, 'c'}};
+  ASSERT_EQ((*std::prev(s21_map.cend())).second, 'c');
+  ASSERT_EQ(std::distance(s21_map.cbegin(), s21_map.cend()), 3);
+  auto it = std::find_if(s21_map.begin(), s21_map.end(),
+                         [](const auto& item) { return item.second == 'b'; });
+  ASSERT_EQ((*it).first, 2);
+}
+
 TEST(Map_Iterators, Begin_Exist) {
   s21::map<int, int> s21_map = {{4, 2}, {1, 3}, {2, 4}, {3, 1}, {1, 3}};
   std::map<int, int> std_map = {{4, 2}, {1, 3}, {2, 4}, {3, 1}, {1, 3}};
@@ -4388,6 +5581,70 @@ TEST(Map_Iterators, End_Empty) {
   EXPECT_NO_THROW(s21_map.end());
 }
 
+TEST(Map_Iterators, Const_Map) {
+  const s21::map<int, int> s21_map = {{2, 20}, {1, 10}};
+  static_assert(std::is_same_v<decltype(*s21_map.cbegin()),
+                               const std::pair<const int, int>&>);
+  ASSERT_EQ(s21_map.at(2), 20);
+  ASSERT_THROW(s21_map.at(3), std::out_of_range);
+  ASSERT_EQ((*s21_map.find(1)).second, 10);
+  ASSERT_EQ(s21_map.find(3), s21_map.cend());
+  auto range = s21_map.equal_range(1);
+  ASSERT_EQ((*range.second).first, 2);
+}
+
+TEST(Map_Compare, Greater_Order) {
+  s21::map<int, char, std::greater<int>> s21_map = {
+      {1, 'a'}, {3, 'c'}, {2, 'b'}};
+  std::string order;
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it) {
+    order += (*it).second;
+  }
+  ASSERT_EQ(order, "cba");
+  ASSERT_TRUE(s21_map.value_comp()({2, 'x'}, {1, 'y'}));
+  ASSERT_EQ(s21_map.erase(2), 1U);
+  ASSERT_EQ(s21_map.count(2), 0U);
+}
+
+TEST(Map_Compare, Transparent_Lookup) {
+  s21::map<std::string, int, std::less<>> s21_map = {
+      {"one", 1}, {"two", 2}, {"three", 3}};
+  const std::string_view key = "two";
+  ASSERT_EQ(s21_map.at(key), 2);
+  s21_map.at(key) = 20;
+  ASSERT_EQ(std::as_const(s21_map).at(key), 20);
+  ASSERT_THROW(s21_map.at(std::string_view("four")), std::out_of_range);
+  ASSERT_TRUE(s21_map.contains("one"));
+  ASSERT_EQ(s21_map.count("four"), 0U);
+  ASSERT_EQ((*s21_map.find(key)).second, 20);
+  ASSERT_EQ((*s21_map.lower_bound("p")).first, "three");
+  ASSERT_EQ(s21_map.erase(key), 1U);
+  ASSERT_EQ(s21_map.size(), 2U);
+}
+
+TEST(Map_OrderStatistic, Nth_Rank_And_Range) {
+  s21::ranked::map<std::string, int> s21_map = {
+      {"delta", 4}, {"alpha", 1}, {"echo", 5}, {"bravo", 2}, {"charlie", 3}};
+  ASSERT_EQ((*s21_map.nth(2)).first, "charlie");
+  ASSERT_EQ(s21_map.rank("c"), 2U);
+  ASSERT_EQ(s21_map.count_range("b", "e"), 3U);
+  s21_map.erase("bravo");
+  s21_map["beta"] = 0;
+  s21_map.insert_or_assign("foxtrot", 6);
+  ASSERT_EQ((*s21_map.nth(1)).first, "beta");
+  ASSERT_EQ(s21_map.index(s21_map.find("foxtrot")), 5U);
+  ASSERT_EQ(s21_map.distance(s21_map.begin(), s21_map.end()), 6);
+}
+
+TEST(Map_Iterators, End_Empty_Equals_Begin) {
+  s21::map<int, int> s21_map = {{1, 1}};
+  s21_map.erase(s21_map.begin());
+  ASSERT_EQ(s21_map.begin(), s21_map.end());
+  s21_map.insert({2, 2});
+  ASSERT_EQ((*--s21_map.end()).first, 2);
+  ASSERT_EQ(++s21_map.begin(), s21_map.end());
+}
+
 // Capacity
 
 TEST(Map_Capacity, Empty_True) {
@@ -4728,6 +5985,175 @@ TEST(Map_Lookup, Contains_Many) {
   ASSERT_EQ(s21_map.contains(4), 1);
 }
 
+TEST(Map_Lookup, Find) {
+  s21::map<int, int> s21_map = {{4, 2}, {1, 3}, {2, 4}, {3, 1}};
+  ASSERT_EQ((*s21_map.find(2)).second, 4);
+  ASSERT_EQ(s21_map.find(7), s21_map.end());
+}
+
+TEST(Map_Modifiers, Insert_Hint) {
+  s21::map<int, int> s21_map;
+  for (int i = 0; i < 100; ++i) s21_map.insert(s21_map.end(), {i, i * i});
+  auto it = s21_map.emplace_hint(s21_map.end(), 200, 1);
+  ASSERT_EQ((*it).first, 200);
+  it = s21_map.insert(s21_map.find(50), {49, 0});  // Ключ уже есть
+  ASSERT_EQ((*it).second, 49 * 49);
+  ASSERT_EQ(s21_map.size(), 101U);
+  ASSERT_EQ(s21_map.at(99), 99 * 99);
+}
+
+TEST(Map_Allocator, Pool_Map) {
+  using value_type = std::pair<const int, std::string>;
+  s21::map<int, std::string, std::less<int>,
+           s21::pool_allocator<value_type>> s21_map;
+  for (int i = 0; i < 500; ++i) s21_map.insert({i, std::to_string(i)});
+  for (int i = 0; i < 500; i += 2) s21_map.erase(s21_map.find(i));
+  s21_map[1000] = "new";
+  auto moved = std::move(s21_map);
+  ASSERT_EQ(moved.size(), 251U);
+  ASSERT_EQ(moved.at(499), "499");
+  ASSERT_EQ(moved.at(1000), "new");
+  ASSERT_FALSE(moved.contains(250));
+}
+
+TEST(Map_Allocator, Pmr_Resource) {
+  counting_resource resource;
+  {
+    s21::pmr::map<int, std::string> s21_map(&resource);
+    for (int i = 0; i < 50; ++i) s21_map[i] = std::to_string(i);
+    ASSERT_GT(resource.in_use, 0U);
+    s21::pmr::map<int, std::string> copy(&resource);
+    copy = s21_map;
+    s21_map.clear();
+    ASSERT_EQ(copy.at(49), "49");
+    ASSERT_TRUE(copy.get_allocator().resource() == &resource);
+  }
+  ASSERT_EQ(resource.in_use, 0U);
+}
+
+TEST(Map_Modifiers, Try_Emplace) {
+  s21::map<std::string, std::unique_ptr<int>> m;
+  auto inserted = m.try_emplace("a", new int(1));
+  ASSERT_TRUE(inserted.second);
+  auto value = std::make_unique<int>(2);
+  auto existing = m.try_emplace("a", std::move(value));
+  ASSERT_FALSE(existing.second);
+  ASSERT_NE(value, nullptr);  // Ключ уже есть: значение не тронуто
+  ASSERT_EQ(*m.at("a"), 1);
+}
+
+TEST(Map_Modifiers, Emplace_And_Assign) {
+  s21::map<std::string, std::string> m;
+  std::string key = "key";
+  m[std::move(key)] = "first";
+  ASSERT_EQ(m.at("key"), "first");
+  auto result = m.emplace(std::piecewise_construct,
+                          std::forward_as_tuple("pair"),
+                          std::forward_as_tuple(2, 'z'));
+  ASSERT_TRUE(result.second);
+  ASSERT_EQ((*result.first).second, "zz");
+  ASSERT_FALSE(m.emplace("pair", "other").second);
+  ASSERT_FALSE(m.insert_or_assign("pair", "other").second);
+  ASSERT_EQ(m.at("pair"), "other");
+  ASSERT_TRUE(m.insert_or_assign("new", "value").second);
+  ASSERT_EQ(m.size(), 3U);
+}
+
+TEST(Map_Lookup, Bounds) {
+  s21::map<int, char> s21_map = {{10, 'a'}, {20, 'b'}, {30, 'c'}};
+  std::map<int, char> std_map = {{10, 'a'}, {20, 'b'}, {30, 'c'}};
+  ASSERT_EQ(*s21_map.lower_bound(15), *std_map.lower_bound(15));
+  ASSERT_EQ(*s21_map.upper_bound(10), *std_map.upper_bound(10));
+  ASSERT_EQ(s21_map.upper_bound(30), s21_map.end());
+  auto range = s21_map.equal_range(20);
+  ASSERT_EQ((*range.first).first, 20);
+  ASSERT_EQ((*range.second).first, 30);
+}
+
+TEST(Map_Constructor, Range_Duplicates) {
+  std::vector<std::pair<const int, char>> items = {
+      {3, 'a'}, {1, 'b'}, {3, 'c'}, {2, 'd'}, {1, 'e'}};
+  s21::map<int, char> s21_map(items.begin(), items.end());
+  std::map<int, char> std_map(items.begin(), items.end());
+  // Из повторов ключа остается первый
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  for (const auto& item : std_map) {
+    ASSERT_EQ(s21_map.at(item.first), item.second);
+  }
+}
+
+TEST(Map_Constructor, Copy_Large) {
+  s21::map<int, int> original;
+  for (int i = 0; i < 10000; ++i) original.insert({i, -i});
+  s21::map<int, int> copy(original);
+  original[0] = 1;
+  ASSERT_EQ(copy.size(), 10000U);
+  for (int i = 0; i < 10000; ++i) ASSERT_EQ(copy.at(i), -i);
+}
+
+// Значение, копирование которого бросает исключение после заданного числа
+// копий; live считает живые объекты
+struct copy_limited {
+  static inline int live = 0;
+  static inline int copies_left = -1;
+  int value;
+  explicit copy_limited(int v) : value(v) { ++live; }
+  copy_limited(const copy_limited& other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+    ++live;
+  }
+  ~copy_limited() { --live; }
+};
+
+TEST(Map_Constructor, Copy_Throwing_Value) {
+  using limited_map = s21::map<int, copy_limited>;
+  {
+    limited_map original;
+    for (int i = 0; i < 1000; ++i) original.try_emplace(i, i);
+    copy_limited::copies_left = 500;
+    // Уже скопированные узлы освобождаются вместе с исключением
+    ASSERT_THROW(limited_map{original}, std::runtime_error);
+    copy_limited::copies_left = -1;
+    ASSERT_EQ(copy_limited::live, 1000);
+    limited_map copy(original);
+    ASSERT_EQ(copy.at(999).value, 999);
+  }
+  ASSERT_EQ(copy_limited::live, 0);
+}
+
+TEST(Map_Algebra, Values_From_Lhs) {
+  s21::map<int, char> lhs = {{1, 'a'}, {2, 'b'}, {4, 'd'}};
+  s21::map<int, char> rhs = {{2, 'x'}, {3, 'y'}, {4, 'z'}};
+  // При равных ключах значение берется из левого операнда
+  s21::map<int, char> united = lhs.set_union(rhs);
+  ASSERT_EQ(united.size(), 4U);
+  ASSERT_EQ(united.at(2), 'b');
+  ASSERT_EQ(united.at(3), 'y');
+  s21::map<int, char> common = rhs.set_intersection(lhs);
+  ASSERT_EQ(common.size(), 2U);
+  ASSERT_EQ(common.at(4), 'z');
+  s21::map<int, char> only = lhs.set_difference(rhs);
+  ASSERT_EQ(only.size(), 1U);
+  ASSERT_EQ(only.at(1), 'a');
+  s21::map<int, char> either = lhs.set_symmetric_difference(rhs);
+  ASSERT_EQ(either.size(), 2U);
+  ASSERT_TRUE(either.contains(1));
+  ASSERT_TRUE(either.contains(3));
+}
+
+TEST(Map_Modifiers, Merge_Keeps_Existing) {
+  s21::map<int, char> s21_map1 = {{1, 'a'}, {3, 'c'}};
+  s21::map<int, char> s21_map2 = {{1, 'x'}, {2, 'b'}, {4, 'd'}};
+  s21_map1.merge(s21_map2);
+  ASSERT_EQ(s21_map1.size(), 4U);
+  ASSERT_EQ(s21_map1.at(1), 'a');
+  ASSERT_EQ(s21_map1.at(2), 'b');
+  ASSERT_EQ(s21_map1.at(4), 'd');
+  ASSERT_EQ(s21_map2.size(), 1U);
+  ASSERT_EQ(s21_map2.at(1), 'x');
+}
+
 TEST(Map_Operator, Assign_NewMove) {
   s21::map<int, int> s21_map = {{4, 2}, {1, 3}, {2, 4}, {3, 1}, {1, 3}};
   std::map<int, int> std_map = {{4, 2}, {1, 3}, {2, 4}, {3, 1}, {1, 3}};
@@ -4818,6 +6244,7 @@ TEST(Map_Modifiers, Erase_New2) {
     s21_it = s21_map.end();
     std_it = std_map.end();
     std_it--;
+    s21_it--;
     s21_map.erase(s21_it);
     std_map.erase(std_it);
   }
@@ -4852,6 +6279,8 @@ TEST(Map_Modifiers, Insert_Many_1) {
   s21_m.insert_many(std::pair<int, int>{1, 1}, std::pair<int, int>{2, 2},
                     std::pair<int, int>{3, 3}, std::pair<int, int>{4, 4},
                     std::pair<int, int>{5, 5});
+  --s21_it;
+  --std_it;
   ASSERT_EQ((*s21_it).first, (*std_it).first);
 }
 
@@ -4981,6 +6410,552 @@ TEST(Set_New, Insert99) {
   }
 }
 
+TEST(ConcurrentMapTest, Basic) {
+  s21::concurrent_map<int, std::string> m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_TRUE(m.insert(2, "two"));
+  ASSERT_TRUE(m.insert({1, "one"}));
+  ASSERT_FALSE(m.insert(2, "deux"));
+  ASSERT_EQ(m.at(2), "two");
+  ASSERT_FALSE(m.insert_or_assign(2, "deux"));
+  ASSERT_TRUE(m.insert_or_assign(3, "three"));
+  ASSERT_EQ(m.at(2), "deux");
+  ASSERT_EQ(m.size(), 3U);
+  ASSERT_TRUE(m.contains(3));
+  ASSERT_THROW(m.at(4), std::out_of_range);
+  ASSERT_EQ(m.erase(1), 1U);
+  ASSERT_EQ(m.erase(1), 0U);
+  ASSERT_FALSE(m.contains(1));
+  m.reclaim();
+  std::string joined;
+  m.for_each([&joined](const std::pair<const int, std::string>& item) {
+    joined += std::to_string(item.first) + item.second;
+  });
+  ASSERT_EQ(joined, "2deux3three");
+}
+
+TEST(ConcurrentMapTest, Ordered_After_Erase) {
+  s21::concurrent_map<int, int> m;
+  for (int i = 0; i < 2000; ++i) m.insert((i * 7919) % 2000, i);
+  for (int i = 0; i < 2000; i += 2) ASSERT_EQ(m.erase(i), 1U);
+  ASSERT_EQ(m.size(), 1000U);
+  int expected = 1;
+  m.for_each([&expected](const std::pair<const int, int>& item) {
+    ASSERT_EQ(item.first, expected);
+    expected += 2;
+  });
+  ASSERT_EQ(expected, 2001);
+}
+
+TEST(ConcurrentMapTest, Many_Threads) {
+  const int writers = 4;
+  const int per_writer = 5000;
+  s21::concurrent_map<int, int> m;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+  // Каждый писатель вставляет свои ключи, переписывает их и удаляет
+  // нечетные; все потоки пишут и удаляют вперемешку
+  for (int w = 0; w < writers; ++w) {
+    threads.emplace_back([&m, w] {
+      for (int i = w; i < writers * per_writer; i += writers) {
+        m.insert(i, -1);
+        m.insert_or_assign(i, i);
+        if (i % 2 == 1) m.erase(i);
+      }
+    });
+  }
+  std::atomic<long> bad_reads{0};
+  threads.emplace_back([&] {
+    while (!done.load()) {
+      for (int i = 0; i < writers * per_writer; i += 97) {
+        try {
+          int value = m.at(i);
+          if (value != i && value != -1) ++bad_reads;
+        } catch (const std::out_of_range&) {
+        }
+      }
+      std::this_thread::yield();
+    }
+  });
+  for (int w = 0; w < writers; ++w) threads[w].join();
+  done = true;
+  threads.back().join();
+  ASSERT_EQ(bad_reads.load(), 0);
+  ASSERT_EQ(m.size(), static_cast<size_t>(writers * per_writer / 2));
+  int expected = 0;
+  m.for_each([&expected](const std::pair<const int, int>& item) {
+    ASSERT_EQ(item.first, expected);
+    ASSERT_EQ(item.second, expected);
+    expected += 2;
+  });
+  ASSERT_EQ(expected, writers * per_writer);
+}
+
+// Потокобезопасный ресурс: считает живые блоки и их наибольшее число
+class peak_blocks_resource : public std::pmr::memory_resource {
+ public:
+  std::atomic<long> live{0};
+  std::atomic<long> peak{0};
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t align) override {
+    const long now = ++live;
+    long seen = peak.load();
+    while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+    }
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+  void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+    --live;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(ConcurrentMapTest, Churn_Memory_Bounded) {
+  using pmr_map = s21::concurrent_map<
+      int, int, std::pmr::polymorphic_allocator<std::pair<const int, int>>>;
+  const int writers = 4;
+  const int rounds = 20000;
+  const int keys = 16;
+  peak_blocks_resource resource;
+  {
+    pmr_map m(&resource);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    // Писатели без конца вставляют и удаляют ключи из маленького набора,
+    // читатель все это время обходит и ищет их
+    for (int w = 0; w < writers; ++w) {
+      threads.emplace_back([&m, w] {
+        for (int i = 0; i < rounds; ++i) {
+          const int key = w * keys + i % keys;
+          m.insert(key, i);
+          m.erase(key);
+        }
+      });
+    }
+    threads.emplace_back([&] {
+      while (!done.load()) {
+        long sum = 0;
+        m.for_each([&sum](const std::pair<const int, int>& item) {
+          sum += item.second;
+        });
+        for (int key = 0; key < writers * keys; ++key) sum += m.contains(key);
+        (void)sum;
+      }
+    });
+    for (int w = 0; w < writers; ++w) threads[w].join();
+    done = true;
+    threads.back().join();
+    ASSERT_TRUE(m.empty());
+    // Удаленные узлы освобождаются по ходу работы: живых блоков намного
+    // меньше, чем удалений (writers * rounds = 80000)
+    EXPECT_LT(resource.peak.load(), 4096);
+    m.reclaim();
+    EXPECT_EQ(resource.live.load(), 1);  // Остается только голова списка
+  }
+  EXPECT_EQ(resource.live.load(), 0);
+}
+
+// btree_tests
+
+TEST(BtreeSetTest, Matches_Std_Set) {
+  s21::btree_set<int> s;
+  std::set<int> expected;
+  std::mt19937 rng(42);
+  for (int i = 0; i < 30000; ++i) {
+    int key = static_cast<int>(rng() % 5000);
+    if (rng() % 3 != 0) {
+      ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+    } else if (expected.erase(key) != 0) {
+      s.erase(s.find(key));
+    } else {
+      ASSERT_TRUE(s.find(key) == s.end());
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (int key : expected) ASSERT_EQ(*it++, key);
+  ASSERT_TRUE(it == s.end());
+  // Обратный обход от end()
+  for (auto r = expected.rbegin(); r != expected.rend(); ++r) {
+    ASSERT_EQ(*--it, *r);
+  }
+  ASSERT_TRUE(it == s.begin());
+}
+
+TEST(BtreeSetTest, Bounds_And_Hint) {
+  s21::btree_set<int> s;
+  auto hint = s.end();
+  for (int i = 0; i < 10000; i += 2) hint = ++s.insert(hint, i);
+  ASSERT_EQ(s.size(), 5000U);
+  ASSERT_EQ(*s.lower_bound(101), 102);
+  ASSERT_EQ(*s.upper_bound(102), 104);
+  ASSERT_TRUE(s.lower_bound(9999) == s.end());
+  auto range = s.equal_range(50);
+  ASSERT_EQ(*range.first, 50);
+  ASSERT_EQ(*range.second, 52);
+  // Неверная подсказка не нарушает порядок
+  s.insert(s.begin(), 5001);
+  ASSERT_TRUE(s.contains(5001));
+  ASSERT_EQ(*++s.find(5000), 5001);
+  ASSERT_EQ(s.count(5001), 1U);
+}
+
+TEST(BtreeSetTest, Copy_Move_Merge) {
+  s21::btree_set<std::string> s = {"b", "d", "f"};
+  s21::btree_set<std::string> copy(s);
+  s21::btree_set<std::string> other = {"a", "b", "c"};
+  copy.merge(other);
+  ASSERT_EQ(copy.size(), 5U);
+  ASSERT_EQ(other.size(), 1U);
+  ASSERT_EQ(*other.begin(), "b");
+  s21::btree_set<std::string> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(*moved.begin(), "a");
+  s = moved;
+  s.erase(s.find("c"));
+  ASSERT_EQ(moved.size(), 5U);
+  ASSERT_EQ(s.size(), 4U);
+  s.swap(moved);
+  ASSERT_TRUE(s.contains("c"));
+  auto results = moved.insert_many("x", "a", "y");
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+  ASSERT_EQ(*results[2].first, "y");
+}
+
+TEST(BtreeSetTest, Insert_Many_Out_Of_Order) {
+  s21::btree_set<int> small;
+  auto first = small.insert_many(5, 1);
+  ASSERT_EQ(*first[0].first, 5);
+  ASSERT_EQ(*first[1].first, 1);
+  // Корневой лист заполнен: первая же вставка делит его, и следующие
+  // сдвигают элементы уже в новых узлах
+  using set_type = s21::btree_set<std::string>;
+  set_type s;
+  for (int i = 0; i < set_type::kSlots; ++i) {
+    s.insert("key-" + std::to_string(100 + 2 * i));
+  }
+  auto results = s.insert_many("key-101", "key-099", "key-100", "key-105");
+  ASSERT_TRUE(results[0].second);
+  ASSERT_TRUE(results[1].second);
+  ASSERT_FALSE(results[2].second);
+  ASSERT_TRUE(results[3].second);
+  ASSERT_EQ(*results[0].first, "key-101");
+  ASSERT_EQ(*results[1].first, "key-099");
+  ASSERT_EQ(*results[2].first, "key-100");
+  ASSERT_EQ(*results[3].first, "key-105");
+}
+
+TEST(BtreeSetTest, Pmr_Allocator) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::pmr::btree_set<int> s{std::pmr::polymorphic_allocator<int>(&resource)};
+  for (int i = 1000; i > 0; --i) s.insert(i);
+  ASSERT_EQ(*s.begin(), 1);
+  ASSERT_EQ(s.size(), 1000U);
+  ASSERT_EQ(s.get_allocator().resource(), &resource);
+}
+
+TEST(BtreeMapTest, Interface) {
+  s21::btree_map<std::string, int> m;
+  for (int i = 0; i < 500; ++i) m[std::to_string(i)] = i;
+  ASSERT_EQ(m.at("42"), 42);
+  ASSERT_THROW(m.at("500"), std::out_of_range);
+  ASSERT_FALSE(m.insert_or_assign("7", 70).second);
+  ASSERT_TRUE(m.insert_or_assign("700", 700).second);
+  ASSERT_FALSE(m.try_emplace("8", 80).second);
+  ASSERT_EQ(m.at("8"), 8);
+  ASSERT_TRUE(m.insert({"9x", 9}).second);
+  // Удаление переносит пары между узлами: ключи не должны теряться
+  for (int i = 0; i < 500; i += 2) m.erase(m.find(std::to_string(i)));
+  ASSERT_EQ(m.size(), 252U);
+  for (int i = 1; i < 500; i += 2) {
+    ASSERT_EQ(m.at(std::to_string(i)), i == 7 ? 70 : i);
+  }
+  std::string previous;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    ASSERT_LT(previous, it->first);
+    previous = it->first;
+  }
+}
+
+TEST(BtreeMapTest, Insert_Own_Value) {
+  using map_type = s21::btree_map<int, std::string>;
+  map_type m;
+  // Значения длиннее SSO: перенесенная строка остается пустой
+  for (int i = 1; i <= map_type::kSlots; ++i) {
+    m[2 * i] = "value-of-a-long-string-" + std::to_string(2 * i);
+  }
+  // Лист заполнен: аргумент переживает деление узла
+  ASSERT_TRUE(m.insert_or_assign(5, m.at(2 * map_type::kSlots)).second);
+  ASSERT_EQ(m.at(5), m.at(2 * map_type::kSlots));
+  // И сдвиг элементов внутри узла
+  ASSERT_TRUE(m.try_emplace(1, m.at(2)).second);
+  ASSERT_EQ(m.at(1), "value-of-a-long-string-2");
+  ASSERT_EQ(m.size(), static_cast<size_t>(map_type::kSlots + 2));
+}
+
+TEST(BtreeMapTest, Move_Only_Value) {
+  s21::btree_map<int, std::unique_ptr<int>> m;
+  for (int i = 0; i < 300; ++i) m.try_emplace(i, new int(i));
+  m.insert_or_assign(5, std::make_unique<int>(50));
+  for (int i = 0; i < 300; i += 3) m.erase(m.find(i));
+  ASSERT_EQ(m.size(), 200U);
+  ASSERT_EQ(*m.at(5), 50);
+  ASSERT_EQ(*m[299], 299);
+}
+
+// flat_tests
+
+TEST(FlatSetTest, Bulk_Construction) {
+  std::vector<int> input;
+  for (int i = 0; i < 1000; ++i) input.push_back(i * 7919 % 500);
+  s21::flat_set<int> s(input.begin(), input.end());
+  std::set<int> expected(input.begin(), input.end());
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+  s21::flat_set<int> list = {5, 3, 5, 1, 3};
+  ASSERT_EQ(list.size(), 3U);
+  ASSERT_EQ(*list.begin(), 1);
+  ASSERT_EQ(*(list.end() - 1), 5);
+}
+
+TEST(FlatSetTest, Matches_Std_Set) {
+  s21::flat_set<int> s;
+  std::set<int> expected;
+  std::mt19937 gen(21);
+  for (int i = 0; i < 3000; ++i) {
+    const int key = static_cast<int>(gen() % 1000);
+    if (gen() % 3 == 0 && s.contains(key)) {
+      s.erase(s.find(key));
+      expected.erase(key);
+    } else {
+      ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+  ASSERT_EQ(s.lower_bound(500) - s.begin(),
+            std::distance(expected.begin(), expected.lower_bound(500)));
+  ASSERT_EQ(s.upper_bound(1000), s.end());
+  ASSERT_EQ(s.find(1000), s.end());
+  ASSERT_EQ(s.count(*s.begin()), 1U);
+}
+
+TEST(FlatSetTest, Insert_Range_And_Many) {
+  s21::flat_set<int> s = {10, 20, 30};
+  const std::vector<int> run = {35, 5, 20, 15, 5};
+  s.insert(run.begin(), run.end());
+  const std::vector<int> expected = {5, 10, 15, 20, 30, 35};
+  ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+  // Результаты в порядке аргументов: повтор внутри пачки не вставляется
+  auto results = s.insert_many(40, 1, 10, 40);
+  ASSERT_EQ(results.size(), 4U);
+  ASSERT_EQ(*results[0].first, 40);
+  ASSERT_TRUE(results[0].second);
+  ASSERT_EQ(*results[1].first, 1);
+  ASSERT_TRUE(results[1].second);
+  ASSERT_EQ(*results[2].first, 10);
+  ASSERT_FALSE(results[2].second);
+  ASSERT_EQ(results[3].first, results[0].first);
+  ASSERT_FALSE(results[3].second);
+  ASSERT_EQ(s.size(), 8U);
+  ASSERT_TRUE(std::is_sorted(s.begin(), s.end()));
+}
+
+TEST(FlatSetTest, Hint_Merge_Pmr) {
+  s21::flat_set<int> s;
+  for (int i = 0; i < 100; ++i) s.insert(s.end(), i);
+  ASSERT_EQ(*s.insert(s.begin(), 50), 50);
+  ASSERT_EQ(*s.emplace_hint(s.begin(), 150), 150);
+  s21::flat_set<int> other = {0, 99, 200, 201};
+  s.merge(other);
+  ASSERT_EQ(s.size(), 103U);
+  ASSERT_EQ(other.size(), 2U);
+  ASSERT_EQ(*other.begin(), 0);
+  char buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer));
+  s21::pmr::flat_set<int> p{std::pmr::polymorphic_allocator<int>(&resource)};
+  for (int i = 0; i < 100; ++i) p.insert(100 - i);
+  ASSERT_EQ(*p.begin(), 1);
+  ASSERT_EQ(p.get_allocator().resource(), &resource);
+}
+
+TEST(FlatMapTest, Interface) {
+  const std::vector<std::pair<std::string, int>> table = {
+      {"b", 2}, {"a", 1}, {"c", 3}, {"a", 10}};
+  s21::flat_map<std::string, int> m(table.begin(), table.end());
+  ASSERT_EQ(m.size(), 3U);
+  ASSERT_EQ(m.at("a"), 1);
+  ASSERT_THROW(m.at("z"), std::out_of_range);
+  m["d"] = 4;
+  ASSERT_FALSE(m.insert_or_assign("b", 20).second);
+  ASSERT_TRUE(m.try_emplace("e", 5).second);
+  ASSERT_FALSE(m.try_emplace("e", 50).second);
+  ASSERT_EQ(m.at("b"), 20);
+  ASSERT_EQ(m.at("e"), 5);
+  ASSERT_EQ(m.begin()->first, "a");
+  ASSERT_EQ((m.end() - 1)->first, "e");
+  m.erase(m.find("c"));
+  ASSERT_FALSE(m.contains("c"));
+  ASSERT_EQ(m.size(), 4U);
+}
+
+TEST(FlatMapTest, Move_Only_Value) {
+  s21::flat_map<int, std::unique_ptr<int>> m;
+  for (int i = 0; i < 100; ++i) m.try_emplace(99 - i, new int(i));
+  m.insert_or_assign(5, std::make_unique<int>(50));
+  ASSERT_EQ(*m.at(5), 50);
+  ASSERT_EQ(*m[0], 99);
+  ASSERT_EQ(m.size(), 100U);
+}
+
+// unordered_tests
+
+TEST(UnorderedSetTest, Matches_Std_Unordered_Set) {
+  s21::unordered_set<int> s;
+  std::set<int> expected;
+  std::mt19937 gen(17);
+  for (int i = 0; i < 20000; ++i) {
+    const int key = static_cast<int>(gen() % 3000);
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(s.erase(key), expected.erase(key));
+    } else {
+      ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  std::set<int> seen;
+  for (int key : s) seen.insert(key);
+  ASSERT_EQ(seen, expected);
+  for (int key = 0; key < 3000; ++key) {
+    ASSERT_EQ(s.count(key), expected.count(key));
+  }
+  ASSERT_EQ(s.find(3000), s.end());
+}
+
+TEST(UnorderedSetTest, Erase_Keeps_Iterators) {
+  s21::unordered_set<int> s = {1, 2, 3, 4, 5, 6};
+  for (auto it = s.begin(); it != s.end();) {
+    auto next = it;
+    ++next;
+    if (*it % 2 == 0) s.erase(it);
+    it = next;
+  }
+  ASSERT_EQ(s.size(), 3U);
+  ASSERT_TRUE(s.contains(1) && s.contains(3) && s.contains(5));
+  s.clear();
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(s.begin(), s.end());
+}
+
+TEST(UnorderedSetTest, Reserve_Rehash_Load_Factor) {
+  s21::unordered_set<int> s;
+  ASSERT_EQ(s.bucket_count(), 0U);
+  s.reserve(1000);
+  const std::size_t buckets = s.bucket_count();
+  ASSERT_GE(buckets * s.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) s.insert(i);
+  ASSERT_EQ(s.bucket_count(), buckets);
+  ASSERT_LE(s.load_factor(), s.max_load_factor());
+  s.max_load_factor(0.25f);
+  ASSERT_LE(s.load_factor(), 0.25f);
+  ASSERT_GT(s.bucket_count(), buckets);
+  ASSERT_THROW(s.max_load_factor(0.0f), std::invalid_argument);
+  s.rehash(10000);
+  ASSERT_GE(s.bucket_count(), 10000U);
+  for (int i = 0; i < 1000; ++i) ASSERT_TRUE(s.contains(i));
+  for (int i = 0; i < 1000; ++i) s.erase(i);
+  s.rehash(0);
+  ASSERT_EQ(s.bucket_count(), 0U);
+}
+
+struct string_hash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view text) const {
+    return std::hash<std::string_view>()(text);
+  }
+};
+
+TEST(UnorderedSetTest, Heterogeneous_Lookup) {
+  s21::unordered_set<std::string, string_hash, std::equal_to<>> s = {
+      "alpha", "beta"};
+  const std::string_view key = "beta";
+  ASSERT_TRUE(s.contains(key));
+  ASSERT_EQ(*s.find(key), "beta");
+  ASSERT_EQ(s.count("gamma"), 0U);
+  ASSERT_EQ(s.find(std::string_view("gamma")), s.end());
+}
+
+TEST(UnorderedSetTest, Copy_Move_Pmr) {
+  s21::unordered_set<int> s;
+  for (int i = 0; i < 500; ++i) s.insert(i * 3);
+  s21::unordered_set<int> copy(s);
+  ASSERT_EQ(copy.size(), 500U);
+  s21::unordered_set<int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_TRUE(moved.contains(1497));
+  copy = moved;
+  moved.insert(1);
+  ASSERT_FALSE(copy.contains(1));
+  auto results = copy.insert_many(1, 3, 1);
+  ASSERT_TRUE(results[0].second);
+  ASSERT_FALSE(results[1].second);
+  ASSERT_EQ(results[2].first, results[0].first);
+  std::pmr::monotonic_buffer_resource resource;
+  s21::pmr::unordered_set<int> p{std::pmr::polymorphic_allocator<int>(
+      &resource)};
+  for (int i = 0; i < 100; ++i) p.insert(i);
+  ASSERT_EQ(p.size(), 100U);
+  ASSERT_EQ(p.get_allocator().resource(), &resource);
+}
+
+TEST(UnorderedMapTest, Interface) {
+  s21::unordered_map<std::string, int> m;
+  for (int i = 0; i < 1000; ++i) m[std::to_string(i)] = i;
+  ASSERT_EQ(m.at("42"), 42);
+  ASSERT_THROW(m.at("1000"), std::out_of_range);
+  ASSERT_FALSE(m.insert_or_assign("7", 70).second);
+  ASSERT_TRUE(m.try_emplace("x", 1).second);
+  ASSERT_FALSE(m.try_emplace("x", 2).second);
+  ASSERT_EQ(m.at("x"), 1);
+  ASSERT_TRUE(m.insert({"y", 2}).second);
+  for (int i = 0; i < 1000; i += 2) ASSERT_EQ(m.erase(std::to_string(i)), 1U);
+  ASSERT_EQ(m.size(), 502U);
+  // Перестройка переносит пары: ключи и значения не должны теряться
+  m.reserve(10000);
+  for (int i = 1; i < 1000; i += 2) {
+    ASSERT_EQ(m.at(std::to_string(i)), i == 7 ? 70 : i);
+  }
+}
+
+TEST(UnorderedMapTest, Insert_Own_Value) {
+  s21::unordered_map<int, std::string> m;
+  // Строки длиннее SSO: перенесенная при перестройке строка пустая
+  const std::string value = "a value longer than the small string buffer";
+  m.try_emplace(0, value);
+  m.try_emplace(1, value);
+  // Среди вставок есть и те, что перестраивают таблицу
+  for (int i = 2; i < 200; i += 2) {
+    ASSERT_TRUE(m.insert_or_assign(i, m.at(i - 2)).second);
+    ASSERT_TRUE(m.try_emplace(i + 1, m.at(i - 1)).second);
+  }
+  for (int i = 0; i < 200; ++i) ASSERT_EQ(m.at(i), value);
+}
+
+TEST(UnorderedMapTest, Move_Only_Value) {
+  s21::unordered_map<int, std::unique_ptr<int>> m;
+  for (int i = 0; i < 300; ++i) m.try_emplace(i, new int(i));
+  m.insert_or_assign(5, std::make_unique<int>(50));
+  for (int i = 0; i < 300; i += 3) m.erase(i);
+  ASSERT_EQ(m.size(), 200U);
+  ASSERT_EQ(*m.at(5), 50);
+  ASSERT_EQ(*m[299], 299);
+}
+
 // tests_list
 
 // Constructors
@@ -5622,6 +7597,46 @@ TEST(List_Modifiers, Merge_Full) {
   ASSERT_EQ(s21_list.empty(), std_list.empty());
 }
 
+TEST(List_Modifiers, Merge_Sorted) {
+  s21::list<int> s21_list = {1, 4, 4, 9, 12};
+  std::list<int> std_list = {1, 4, 4, 9, 12};
+  s21::list<int> s21_list2 = {0, 4, 5, 6, 13, 20};
+  std::list<int> std_list2 = {0, 4, 5, 6, 13, 20};
+  s21_list.merge(s21_list2);
+  std_list.merge(std_list2);
+  ASSERT_TRUE(s21_list2.empty());
+  ASSERT_EQ(s21_list.size(), std_list.size());
+  ASSERT_EQ(s21_list.back(), std_list.back());
+  s21::list<int>::iterator s21_it = s21_list.begin();
+  for (auto std_it = std_list.begin(); std_it != std_list.end(); std_it++) {
+    ASSERT_EQ(*s21_it, *std_it);
+    s21_it++;
+  }
+}
+
+TEST(List_Modifiers, Merge_Compare_Move_Only) {
+  using ptr = std::unique_ptr<int>;
+  auto greater = [](const ptr& a, const ptr& b) { return *a > *b; };
+  s21::list<ptr> s21_list;
+  s21::list<ptr> s21_list2;
+  for (int value : {9, 5, 1}) s21_list.push_back(std::make_unique<int>(value));
+  for (int value : {8, 5, 2}) s21_list2.push_back(std::make_unique<int>(value));
+  int* second_five = (*(++s21_list2.begin())).get();
+  s21_list.merge(s21_list2, greater);
+  ASSERT_TRUE(s21_list2.empty());
+  ASSERT_EQ(s21_list.size(), 6U);
+  s21::list<ptr>::iterator it = s21_list.begin();
+  for (int expected : {9, 8, 5, 5, 2, 1}) {
+    ASSERT_EQ(**it, expected);
+    ++it;
+  }
+  // Равные элементы: сначала из this, узел other перевешен без копирования
+  it = s21_list.begin();
+  for (int i = 0; i < 3; ++i) ++it;
+  ASSERT_EQ((*it).get(), second_five);
+  ASSERT_EQ(*s21_list.back(), 1);
+}
+
 // Splice
 
 TEST(List_Modifiers, Splice_EmptyBoth) {
@@ -5666,6 +7681,54 @@ TEST(List_Modifiers, Splice_FullFromMiddle) {
   ASSERT_EQ(s21_list2.empty(), std_list2.empty());
 }
 
+TEST(List_Modifiers, Splice_Element_And_Range) {
+  s21::list<int> s21_list = {1, 2, 3};
+  std::list<int> std_list = {1, 2, 3};
+  s21::list<int> s21_list2 = {10, 20, 30, 40};
+  std::list<int> std_list2 = {10, 20, 30, 40};
+  s21_list.splice(s21_list.begin(), s21_list2, ++s21_list2.begin());
+  std_list.splice(std_list.begin(), std_list2, ++std_list2.begin());
+  s21_list.splice(s21_list.end(), s21_list2, ++s21_list2.begin(),
+                  s21_list2.end());
+  std_list.splice(std_list.end(), std_list2, ++std_list2.begin(),
+                  std_list2.end());
+  // Внутри одного списка: первый элемент в конец
+  s21_list.splice(s21_list.end(), s21_list, s21_list.begin());
+  std_list.splice(std_list.end(), std_list, std_list.begin());
+  ASSERT_EQ(s21_list2.size(), std_list2.size());
+  ASSERT_EQ(s21_list2.front(), std_list2.front());
+  ASSERT_EQ(s21_list2.back(), std_list2.back());
+  ASSERT_EQ(s21_list.size(), std_list.size());
+  ASSERT_EQ(s21_list.back(), std_list.back());
+  ASSERT_EQ(*(--s21_list.end()), std_list.back());
+  s21::list<int>::iterator s21_it = s21_list.begin();
+  for (auto std_it = std_list.begin(); std_it != std_list.end(); std_it++) {
+    ASSERT_EQ(*s21_it, *std_it);
+    s21_it++;
+  }
+}
+
+TEST(List_Modifiers, Splice_Different_Resources) {
+  counting_resource first_resource;
+  counting_resource second_resource;
+  {
+    s21::pmr::list<std::string> first(&first_resource);
+    s21::pmr::list<std::string> second(&second_resource);
+    first.push_back("a");
+    second.push_back("b");
+    second.push_back("c");
+    std::size_t second_in_use = second_resource.in_use;
+    first.splice(first.end(), second);
+    // Узлы чужого ресурса не перевешиваются: элементы перемещены
+    ASSERT_TRUE(second.empty());
+    ASSERT_LT(second_resource.in_use, second_in_use);
+    ASSERT_EQ(first.size(), 3U);
+    ASSERT_EQ(first.back(), "c");
+  }
+  ASSERT_EQ(first_resource.in_use, 0U);
+  ASSERT_EQ(second_resource.in_use, 0U);
+}
+
 TEST(List_Modifiers, Reverse_Empty) {
   s21::list<int> s21_list;
   std::list<int> std_list;
@@ -5698,6 +7761,21 @@ TEST(List_Modifiers, Reverse_Many) {
   }
 }
 
+TEST(List_Modifiers, Reverse_Relinks) {
+  s21::list<std::unique_ptr<int>> s21_list;
+  for (int i = 0; i < 4; ++i) s21_list.push_back(std::make_unique<int>(i));
+  int* first = s21_list.front().get();
+  s21_list.reverse();
+  ASSERT_EQ(s21_list.back().get(), first);
+  ASSERT_EQ(**(--s21_list.end()), 0);
+  s21_list.push_back(std::make_unique<int>(-1));
+  s21::list<std::unique_ptr<int>>::iterator it = s21_list.begin();
+  for (int expected : {3, 2, 1, 0, -1}) {
+    ASSERT_EQ(**it, expected);
+    ++it;
+  }
+}
+
 TEST(List_Modifiers, Unique_Empty) {
   s21::list<int> s21_list;
   std::list<int> std_list;
@@ -5762,6 +7840,63 @@ TEST(List_Modifiers, Sort_Many) {
   }
 }
 
+TEST(List_Modifiers, Sort_Large) {
+  s21::list<int> s21_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 5000; ++i) {
+    int value = (i * 7919) % 1013;
+    s21_list.push_back(value);
+    std_list.push_back(value);
+  }
+  s21_list.sort();
+  std_list.sort();
+  ASSERT_EQ(s21_list.size(), std_list.size());
+  ASSERT_EQ(s21_list.back(), std_list.back());
+  ASSERT_EQ(*(--s21_list.end()), std_list.back());
+  s21::list<int>::iterator s21_it = s21_list.begin();
+  for (auto std_it = std_list.begin(); std_it != std_list.end(); std_it++) {
+    ASSERT_EQ(*s21_it, *std_it);
+    s21_it++;
+  }
+}
+
+TEST(List_Modifiers, Sort_Compare_Stable) {
+  using item = std::pair<int, int>;
+  auto by_key = [](const item& a, const item& b) { return a.first > b.first; };
+  s21::list<item> s21_list;
+  std::list<item> std_list;
+  for (int i = 0; i < 300; ++i) {
+    s21_list.push_back({i % 7, i});
+    std_list.push_back({i % 7, i});
+  }
+  s21_list.sort(by_key);
+  std_list.sort(by_key);  // std::list::sort тоже устойчива
+  s21::list<item>::iterator s21_it = s21_list.begin();
+  for (auto std_it = std_list.begin(); std_it != std_list.end(); std_it++) {
+    ASSERT_EQ(*s21_it, *std_it);
+    s21_it++;
+  }
+}
+
+TEST(List_Modifiers, Sort_Throwing_Compare) {
+  s21::list<int> s21_list;
+  for (int i = 0; i < 100; ++i) s21_list.push_front(i);
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 150) throw std::runtime_error("compare");
+    return a < b;
+  };
+  ASSERT_THROW(s21_list.sort(comp), std::runtime_error);
+  ASSERT_EQ(s21_list.size(), 100U);
+  int sum = 0;
+  s21::list<int>::iterator it = s21_list.begin();
+  for (size_t i = 0; i < s21_list.size(); ++i, ++it) sum += *it;
+  ASSERT_EQ(sum, 99 * 100 / 2);
+  s21_list.sort();
+  ASSERT_EQ(s21_list.front(), 0);
+  ASSERT_EQ(s21_list.back(), 99);
+}
+
 // Containersplus Modifiers
 
 TEST(List_ModifiersPlus, Insert_many_Empty) {
@@ -5983,3 +8118,57 @@ TEST(List_Iterator, Decrement2) {
     n--;
   }
 }
+
+TEST(List_Operator, Pmr_Resource) {
+  counting_resource first;
+  counting_resource second;
+  {
+    s21::pmr::list<int> s21_list(&first);
+    for (int i = 0; i < 20; ++i) s21_list.push_back(i);
+    s21::pmr::list<int> other(&second);
+    other.push_back(-1);
+    other = std::move(s21_list);
+    ASSERT_TRUE(other.get_allocator().resource() == &second);
+    ASSERT_EQ(other.size(), 20U);
+    ASSERT_EQ(other.front(), 0);
+    ASSERT_EQ(other.back(), 19);
+    s21::pmr::list<int> copy(&first);
+    copy = other;
+    copy.sort();
+    copy.reverse();
+    ASSERT_EQ(copy.front(), 19);
+  }
+  ASSERT_EQ(first.in_use, 0U);
+  ASSERT_EQ(second.in_use, 0U);
+}
+
+TEST(List_Modifiers, Emplace_String) {
+  s21::list<std::string> l;
+  l.emplace_back(2, 'b');
+  l.emplace_front("a");
+  l.emplace(l.end(), "d");
+  auto it = l.emplace(--l.end(), 1, 'c');
+  ASSERT_EQ(*it, "c");
+  std::list<std::string> expected = {"a", "bb", "c", "d"};
+  auto s21_it = l.begin();
+  for (auto std_it = expected.begin(); std_it != expected.end(); ++std_it) {
+    ASSERT_EQ(*s21_it, *std_it);
+    ++s21_it;
+  }
+  ASSERT_EQ(l.back(), "d");
+  ASSERT_EQ(l.size(), 4U);
+}
+
+TEST(List_Modifiers, Insert_Many_Move_Only) {
+  s21::list<std::unique_ptr<int>> l;
+  l.push_back(std::make_unique<int>(1));
+  l.insert_many_back(std::make_unique<int>(4));
+  auto it = l.insert_many(--l.end(), std::make_unique<int>(2),
+                          std::make_unique<int>(3));
+  ASSERT_EQ(**it, 2);
+  it = l.begin();
+  for (int expected = 1; expected <= 4; ++expected, ++it) {
+    ASSERT_EQ(**it, expected);
+  }
+  ASSERT_EQ(*l.back(), 4);
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_map.h"
+#include "../s21_containersplus/s21_multiset.h"
+#include "../s21_map.h"
+#include "../s21_set.h"
+
+// Нагрузочные тесты для ThreadSanitizer (make tsan): потоки одновременно
+// читают один константный set, map или multiset без блокировок. Запись в
+// дерево из константного метода TSan покажет как гонку, а выделения памяти
+// во время чтения считает подмененный operator new
+
+namespace {
+
+std::atomic<long> allocations{0};
+
+constexpr int kReaders = 32;
+constexpr int kKeys = 1 << 13;
+
+// Запускает kReaders потоков, которые начинают read(номер потока)
+// одновременно, и возвращает число выделений памяти за время чтения
+template <typename Read>
+long RunReaders(Read read) {
+  std::atomic<int> ready{0};
+  std::atomic<int> finished{0};
+  std::atomic<bool> go{false};
+  std::vector<std::thread> threads;
+  threads.reserve(kReaders);
+  for (int t = 0; t < kReaders; ++t) {
+    threads.emplace_back([&, t] {
+      ++ready;
+      while (!go.load()) std::this_thread::yield();
+      read(t);
+      ++finished;
+    });
+  }
+  while (ready.load() < kReaders) std::this_thread::yield();
+  const long before = allocations.load();
+  go = true;
+  while (finished.load() < kReaders) std::this_thread::yield();
+  const long after = allocations.load();
+  for (auto& thread : threads) thread.join();
+  return after - before;
+}
+
+}  // namespace
+
+// Стандартный operator delete освобождает память через free, поэтому
+// подменяется только operator new
+void* operator new(std::size_t size) {
+  ++allocations;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+TEST(TreeConcurrentRead, Set) {
+  s21::set<int> storage;
+  for (int i = 0; i < kKeys; ++i) storage.insert(2 * i);
+  const s21::set<int>& s = storage;
+  std::atomic<long> errors{0};
+  long allocated = RunReaders([&s, &errors](int t) {
+    long bad = 0;
+    for (int i = t; i < 2 * kKeys - 2; i += 5) {
+      const bool even = i % 2 == 0;
+      if (s.contains(i) != even) ++bad;
+      if ((s.find(i) != s.cend()) != even) ++bad;
+      if (*s.lower_bound(i) != (i + 1) / 2 * 2) ++bad;
+      if (*s.upper_bound(i) != i / 2 * 2 + 2) ++bad;
+      auto range = s.equal_range(i);
+      if ((range.first != range.second) != even) ++bad;
+    }
+    long count = 0;
+    for (auto it = s.cbegin(); it != s.cend(); ++it) ++count;
+    if (count != kKeys) ++bad;
+    auto last = s.end();
+    if (*--last != 2 * (kKeys - 1)) ++bad;
+    errors += bad;
+  });
+  EXPECT_EQ(errors.load(), 0);
+  EXPECT_EQ(allocated, 0);
+}
+
+TEST(TreeConcurrentRead, Map) {
+  std::vector<std::string> keys;
+  s21::map<std::string, int> storage;
+  for (int i = 0; i < kKeys; ++i) {
+    keys.push_back("key-" + std::to_string(100000 + i));
+    storage.insert({keys.back(), i});
+  }
+  const s21::map<std::string, int>& m = storage;
+  std::atomic<long> errors{0};
+  long allocated = RunReaders([&m, &keys, &errors](int t) {
+    long bad = 0;
+    for (int i = t; i < kKeys; i += 3) {
+      if (m.at(keys[i]) != i) ++bad;
+      auto it = m.find(keys[i]);
+      if (it == m.cend() || (*it).second != i) ++bad;
+      if (!m.contains(keys[i])) ++bad;
+      if ((*m.lower_bound(keys[i])).second != i) ++bad;
+    }
+    long sum = 0;
+    for (auto it = m.cbegin(); it != m.cend(); ++it) sum += (*it).second;
+    if (sum != static_cast<long>(kKeys) * (kKeys - 1) / 2) ++bad;
+    errors += bad;
+  });
+  EXPECT_EQ(errors.load(), 0);
+  EXPECT_EQ(allocated, 0);
+}
+
+TEST(TreeConcurrentRead, Multiset) {
+  s21::multiset<int> storage;
+  for (int i = 0; i < kKeys; ++i) storage.insert(i % 512);
+  const s21::multiset<int>& ms = storage;
+  std::atomic<long> errors{0};
+  long allocated = RunReaders([&ms, &errors](int t) {
+    long bad = 0;
+    for (int key = t % 8; key < 512; key += 8) {
+      if (ms.count(key) != kKeys / 512) ++bad;
+      auto range = ms.equal_range(key);
+      long count = 0;
+      for (auto it = range.first; it != range.second; ++it) ++count;
+      if (count != kKeys / 512) ++bad;
+    }
+    if (ms.count(-1) != 0 || ms.find(512) != ms.cend()) ++bad;
+    errors += bad;
+  });
+  EXPECT_EQ(errors.load(), 0);
+  EXPECT_EQ(allocated, 0);
+}
+
+TEST(TreeConcurrentRead, Transparent_Lookup_Does_Not_Allocate) {
+  using string_map = s21::map<std::string, int, std::less<>>;
+  std::vector<std::string> keys;
+  string_map storage;
+  for (int i = 0; i < kKeys; ++i) {
+    keys.push_back("transparent-key-" + std::to_string(100000 + i));
+    storage.insert({keys.back(), i});
+  }
+  const string_map& m = storage;
+  std::atomic<long> errors{0};
+  long allocated = RunReaders([&m, &keys, &errors](int t) {
+    long bad = 0;
+    for (int i = t; i < kKeys; i += 7) {
+      // Ключи длиннее SSO: построение std::string выделило бы память
+      const std::string_view key = keys[i];
+      if (m.at(key) != i || !m.contains(key) || m.count(key) != 1) ++bad;
+      if ((*m.find(key)).second != i) ++bad;
+      if (m.contains(key.substr(0, 16))) ++bad;
+    }
+    errors += bad;
+  });
+  EXPECT_EQ(errors.load(), 0);
+  EXPECT_EQ(allocated, 0);
+}
+
+// Писатели вставляют и удаляют ключи, пока читатели ищут и обходят их.
+// Узлы освобождаются по эпохам прямо во время работы: обращение читателя
+// к уже освобожденному узлу TSan покажет как гонку с его разрушением
+TEST(ConcurrentMapChurn, Insert_Erase_With_Readers) {
+  constexpr int kWriters = 4;
+  constexpr int kRounds = 4000;
+  constexpr int kChurnKeys = 32;
+  s21::concurrent_map<int, std::string> m;
+  std::atomic<bool> done{false};
+  std::atomic<long> errors{0};
+  std::vector<std::thread> threads;
+  for (int w = 0; w < kWriters; ++w) {
+    threads.emplace_back([&m, w] {
+      for (int i = 0; i < kRounds; ++i) {
+        const int key = (w + i * kWriters) % kChurnKeys;
+        m.insert_or_assign(key, "value-" + std::to_string(key));
+        m.erase(key);
+      }
+    });
+  }
+  for (int r = 0; r < 2; ++r) {
+    threads.emplace_back([&m, &done, &errors] {
+      while (!done.load()) {
+        m.for_each([&errors](const std::pair<const int, std::string>& item) {
+          if (item.second != "value-" + std::to_string(item.first)) ++errors;
+        });
+        for (int key = 0; key < kChurnKeys; ++key) {
+          try {
+            if (m.at(key) != "value-" + std::to_string(key)) ++errors;
+          } catch (const std::out_of_range&) {
+          }
+        }
+      }
+    });
+  }
+  for (int w = 0; w < kWriters; ++w) threads[w].join();
+  done = true;
+  for (int r = kWriters; r < kWriters + 2; ++r) threads[r].join();
+  EXPECT_EQ(errors.load(), 0);
+  EXPECT_TRUE(m.empty());
+}